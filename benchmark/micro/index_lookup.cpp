@@ -0,0 +1,60 @@
+#include "benchmark_runner.hpp"
+#include "duckdb_benchmark_macro.hpp"
+
+#include <thread>
+
+using namespace duckdb;
+
+//////////////////////////////
+// CONCURRENT INDEX LOOKUPS //
+//////////////////////////////
+#define INDEX_LOOKUP_COUNT      8000
+#define INDEX_LOOKUP_ROWS       1000000
+#define INDEX_LOOKUP_MULTIPLIER 7919
+
+static void RunConcurrentLookups(DuckDBBenchmarkState *state, idx_t reader_count) {
+	// the lookups are split evenly over the readers, so the runtime should drop as readers are added
+	vector<std::thread> readers;
+	for (idx_t r = 0; r < reader_count; r++) {
+		readers.emplace_back([state, r, reader_count]() {
+			Connection con(state->db);
+			auto prepared = con.Prepare("SELECT v FROM lookup WHERE k = $1");
+			for (idx_t i = r; i < INDEX_LOOKUP_COUNT; i += reader_count) {
+				auto key = NumericCast<int64_t>(i * INDEX_LOOKUP_MULTIPLIER % INDEX_LOOKUP_ROWS);
+				prepared->Execute(key);
+			}
+		});
+	}
+	for (auto &reader : readers) {
+		reader.join();
+	}
+}
+
+#define INDEX_LOOKUP_BENCHMARK(READER_COUNT)                                                                           \
+	void Load(DuckDBBenchmarkState *state) override {                                                                  \
+		state->conn.Query("CREATE TABLE lookup(k BIGINT PRIMARY KEY, v BIGINT)");                                      \
+		state->conn.Query("INSERT INTO lookup SELECT range, range * 2 FROM range(" +                                   \
+		                  to_string(INDEX_LOOKUP_ROWS) + ")");                                                         \
+	}                                                                                                                  \
+	void RunBenchmark(DuckDBBenchmarkState *state) override {                                                          \
+		RunConcurrentLookups(state, READER_COUNT);                                                                     \
+	}                                                                                                                  \
+	string VerifyResult(QueryResult *result) override {                                                                \
+		return string();                                                                                               \
+	}                                                                                                                  \
+	string BenchmarkInfo() override {                                                                                  \
+		return to_string(INDEX_LOOKUP_COUNT) + " primary key lookups split over " + to_string(READER_COUNT) +          \
+		       " concurrent readers";                                                                                  \
+	}
+
+DUCKDB_BENCHMARK(ConcurrentIndexLookups1, "[index_lookup]")
+INDEX_LOOKUP_BENCHMARK(1)
+FINISH_BENCHMARK(ConcurrentIndexLookups1)
+
+DUCKDB_BENCHMARK(ConcurrentIndexLookups4, "[index_lookup]")
+INDEX_LOOKUP_BENCHMARK(4)
+FINISH_BENCHMARK(ConcurrentIndexLookups4)
+
+DUCKDB_BENCHMARK(ConcurrentIndexLookups8, "[index_lookup]")
+INDEX_LOOKUP_BENCHMARK(8)
+FINISH_BENCHMARK(ConcurrentIndexLookups8)
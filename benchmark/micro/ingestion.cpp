@@ -0,0 +1,61 @@
+#include "benchmark_runner.hpp"
+#include "duckdb_benchmark_macro.hpp"
+
+#include <thread>
+
+using namespace duckdb;
+
+//////////////////////////
+// CONCURRENT INGESTION //
+//////////////////////////
+#define INGESTION_WRITER_COUNT 8
+#define INGESTION_INSERT_COUNT 2000
+
+static void RunConcurrentWriters(DuckDBBenchmarkState *state) {
+	vector<std::thread> writers;
+	for (idx_t w = 0; w < INGESTION_WRITER_COUNT; w++) {
+		writers.emplace_back([state, w]() {
+			Connection con(state->db);
+			for (idx_t i = 0; i < INGESTION_INSERT_COUNT; i++) {
+				con.Query("INSERT INTO ingest VALUES (" + to_string(w) + ", " + to_string(i) + ")");
+			}
+		});
+	}
+	for (auto &writer : writers) {
+		writer.join();
+	}
+}
+
+#define INGESTION_BENCHMARK(SETTINGS)                                                                                  \
+	void Load(DuckDBBenchmarkState *state) override {                                                                  \
+		state->conn.Query(SETTINGS);                                                                                   \
+		state->conn.Query("CREATE TABLE ingest(writer INTEGER, i INTEGER)");                                           \
+	}                                                                                                                  \
+	void RunBenchmark(DuckDBBenchmarkState *state) override {                                                          \
+		RunConcurrentWriters(state);                                                                                   \
+	}                                                                                                                  \
+	void Cleanup(DuckDBBenchmarkState *state) override {                                                               \
+		state->conn.Query("DROP TABLE ingest");                                                                        \
+		state->conn.Query("CREATE TABLE ingest(writer INTEGER, i INTEGER)");                                           \
+	}                                                                                                                  \
+	string VerifyResult(QueryResult *result) override {                                                                \
+		return string();                                                                                               \
+	}                                                                                                                  \
+	bool InMemory() override {                                                                                         \
+		return false;                                                                                                  \
+	}                                                                                                                  \
+	string BenchmarkInfo() override {                                                                                  \
+		return "8 concurrent writers that each commit 2K single-row INSERT statements to a persistent database";       \
+	}
+
+DUCKDB_BENCHMARK(ConcurrentIngestionSync, "[ingestion]")
+INGESTION_BENCHMARK("SET wal_group_commit=false")
+FINISH_BENCHMARK(ConcurrentIngestionSync)
+
+DUCKDB_BENCHMARK(ConcurrentIngestionGroupCommit, "[ingestion]")
+INGESTION_BENCHMARK("SET wal_group_commit=true")
+FINISH_BENCHMARK(ConcurrentIngestionGroupCommit)
+
+DUCKDB_BENCHMARK(ConcurrentIngestionRelaxedDurability, "[ingestion]")
+INGESTION_BENCHMARK("SET wal_sync_interval=100")
+FINISH_BENCHMARK(ConcurrentIngestionRelaxedDurability)
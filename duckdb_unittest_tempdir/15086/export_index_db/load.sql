@@ -0,0 +1,3 @@
+COPY idx_tbl FROM 'duckdb_unittest_tempdir/15086/export_index_db/idx_tbl.csv' (FORMAT 'csv', quote '"', delimiter ',', header 1);
+COPY pk_tbl FROM 'duckdb_unittest_tempdir/15086/export_index_db/pk_tbl.csv' (FORMAT 'csv', force_not_null 'id', quote '"', delimiter ',', header 1);
+COPY fk_tbl FROM 'duckdb_unittest_tempdir/15086/export_index_db/fk_tbl.csv' (FORMAT 'csv', quote '"', delimiter ',', header 1);
@@ -0,0 +1,179 @@
+#include "http_block_cache.hpp"
+
+#include "crypto.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/to_string.hpp"
+#include "duckdb/common/types/uuid.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+static void TryRemoveFile(FileSystem &fs, const string &path) {
+	try {
+		fs.RemoveFile(path);
+	} catch (std::exception &ex) {
+		// nothing we can do
+	}
+}
+
+HTTPBlockCache::HTTPBlockCache(string directory_p, idx_t max_size_p)
+    : fs(FileSystem::CreateLocal()), directory(std::move(directory_p)), max_size(max_size_p), current_size(0) {
+	if (!fs->DirectoryExists(directory)) {
+		fs->CreateDirectory(directory);
+	}
+	LoadExistingBlocks();
+}
+
+void HTTPBlockCache::LoadExistingBlocks() {
+	struct ExistingBlock {
+		string key;
+		idx_t size;
+		time_t last_modified;
+	};
+	vector<ExistingBlock> existing_blocks;
+	vector<string> temp_files;
+	fs->ListFiles(directory, [&](const string &name, bool is_directory) {
+		if (is_directory) {
+			return;
+		}
+		if (StringUtil::Contains(name, string(BLOCK_EXTENSION) + TEMP_EXTENSION)) {
+			temp_files.push_back(name);
+			return;
+		}
+		if (!StringUtil::EndsWith(name, BLOCK_EXTENSION)) {
+			return;
+		}
+		try {
+			auto handle = fs->OpenFile(fs->JoinPath(directory, name), FileFlags::FILE_FLAGS_READ);
+			auto key = name.substr(0, name.size() - strlen(BLOCK_EXTENSION));
+			existing_blocks.push_back({key, NumericCast<idx_t>(fs->GetFileSize(*handle)),
+			                           fs->GetLastModifiedTime(*handle)});
+		} catch (std::exception &ex) {
+			// unreadable block - skip it
+		}
+	});
+	// temporary files are never read: if a writer in another process is still busy, removing its file only makes
+	// that write fail, which is harmless as the cache is best-effort
+	for (auto &temp_file : temp_files) {
+		TryRemoveFile(*fs, fs->JoinPath(directory, temp_file));
+	}
+	// replay the blocks in order of modification, so the most recently written blocks are evicted last
+	std::sort(existing_blocks.begin(), existing_blocks.end(),
+	          [](const ExistingBlock &a, const ExistingBlock &b) { return a.last_modified < b.last_modified; });
+	lock_guard<mutex> guard(lock);
+	for (auto &block : existing_blocks) {
+		AddBlock(block.key, block.size);
+	}
+	EvictBlocks(0);
+}
+
+idx_t HTTPBlockCache::GetMaxSize() {
+	lock_guard<mutex> guard(lock);
+	return max_size;
+}
+
+void HTTPBlockCache::SetMaxSize(idx_t max_size_p) {
+	lock_guard<mutex> guard(lock);
+	max_size = max_size_p;
+	EvictBlocks(0);
+}
+
+void HTTPBlockCache::AddBlock(const string &key, idx_t size) {
+	auto entry = blocks.find(key);
+	if (entry != blocks.end()) {
+		RemoveBlock(entry);
+	}
+	lru_list.push_front(key);
+	blocks[key] = {size, lru_list.begin()};
+	current_size += size;
+}
+
+void HTTPBlockCache::RemoveBlock(unordered_map<string, CachedBlock>::iterator entry) {
+	current_size -= entry->second.size;
+	lru_list.erase(entry->second.lru_position);
+	blocks.erase(entry);
+}
+
+string HTTPBlockCache::GetBlockKey(const string &url, const string &version, idx_t block_idx) {
+	auto key = url + "\n" + version + "\n" + to_string(block_idx);
+	hash_bytes hash;
+	hash_str hash_hex;
+	sha256(key.c_str(), key.size(), hash);
+	hex256(hash, hash_hex);
+	return string(const_char_ptr_cast(hash_hex), sizeof(hash_str));
+}
+
+string HTTPBlockCache::GetBlockPath(const string &key) const {
+	return fs->JoinPath(directory, key + BLOCK_EXTENSION);
+}
+
+bool HTTPBlockCache::TryRead(const string &key, char *buffer, idx_t size) {
+	{
+		lock_guard<mutex> guard(lock);
+		auto entry = blocks.find(key);
+		if (entry == blocks.end()) {
+			return false;
+		}
+		if (entry->second.size != size) {
+			// the block was written for a different length: drop it
+			RemoveBlock(entry);
+			return false;
+		}
+		// move the block to the front of the LRU list
+		lru_list.splice(lru_list.begin(), lru_list, entry->second.lru_position);
+	}
+	// blocks are immutable once written, so we can read them without holding the lock
+	try {
+		auto handle = fs->OpenFile(GetBlockPath(key), FileFlags::FILE_FLAGS_READ);
+		if (NumericCast<idx_t>(fs->GetFileSize(*handle)) != size) {
+			return false;
+		}
+		fs->Read(*handle, buffer, NumericCast<int64_t>(size), 0);
+		return true;
+	} catch (std::exception &ex) {
+		// the block was evicted in the mean time (or removed externally): treat as a miss
+		return false;
+	}
+}
+
+void HTTPBlockCache::Write(const string &key, const char *buffer, idx_t size) {
+	if (size > GetMaxSize()) {
+		return;
+	}
+	auto block_path = GetBlockPath(key);
+	// write to a temporary file first, so concurrent readers (or other processes) never observe partial blocks
+	auto temp_path = block_path + TEMP_EXTENSION + UUID::ToString(UUID::GenerateRandomUUID());
+	try {
+		{
+			auto handle = fs->OpenFile(temp_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+			fs->Write(*handle, const_cast<char *>(buffer), NumericCast<int64_t>(size), 0);
+			handle->Sync();
+		}
+		fs->MoveFile(temp_path, block_path);
+	} catch (std::exception &ex) {
+		// failed to write the block (e.g. the disk is full) - the cache is best-effort
+		TryRemoveFile(*fs, temp_path);
+		return;
+	}
+
+	lock_guard<mutex> guard(lock);
+	auto entry = blocks.find(key);
+	if (entry != blocks.end()) {
+		// block was written concurrently by another thread
+		RemoveBlock(entry);
+	}
+	EvictBlocks(size);
+	AddBlock(key, size);
+}
+
+void HTTPBlockCache::EvictBlocks(idx_t required_space) {
+	// evict the least recently used blocks until the new block fits
+	while (current_size + required_space > max_size && !lru_list.empty()) {
+		auto key = lru_list.back();
+		RemoveBlock(blocks.find(key));
+		TryRemoveFile(*fs, GetBlockPath(key));
+	}
+}
+
+} // namespace duckdb
@@ -59,6 +59,10 @@ HTTPParams HTTPParams::ReadFrom(optional_ptr<FileOpener> opener, optional_ptr<Fi
 	                                 info);
 	FileOpener::TryGetCurrentSetting(opener, "ca_cert_file", result.ca_cert_file, info);
 	FileOpener::TryGetCurrentSetting(opener, "hf_max_per_page", result.hf_max_per_page, info);
+	FileOpener::TryGetCurrentSetting(opener, "http_block_cache_directory", result.block_cache_directory, info);
+	if (FileOpener::TryGetCurrentSetting(opener, "http_block_cache_max_size", value, info)) {
+		result.block_cache_max_size = DBConfig::ParseMemoryLimit(value.GetValue<string>());
+	}
 
 	// HTTP Secret lookups
 	KeyValueSecretReader settings_reader(*opener, info, "http");
@@ -439,8 +443,8 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::GetRangeRequest(FileHandle &handle,
 }
 
 HTTPFileHandle::HTTPFileHandle(FileSystem &fs, const string &path, FileOpenFlags flags, const HTTPParams &http_params)
-    : FileHandle(fs, path), http_params(http_params), flags(flags), length(0), buffer_available(0), buffer_idx(0),
-      file_offset(0), buffer_start(0), buffer_end(0) {
+    : FileHandle(fs, path), http_params(http_params), flags(flags), length(0), last_modified(0), buffer_available(0),
+      buffer_idx(0), file_offset(0), buffer_start(0), buffer_end(0) {
 }
 
 unique_ptr<HTTPFileHandle> HTTPFileSystem::CreateHandle(const string &path, FileOpenFlags flags,
@@ -512,7 +516,7 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 	// Don't buffer when DirectIO is set or when we are doing parallel reads
 	bool skip_buffer = hfh.flags.DirectIO() || hfh.flags.RequireParallelAccess();
 	if (skip_buffer && to_read > 0) {
-		GetRangeRequest(hfh, hfh.path, {}, location, (char *)buffer, to_read);
+		ReadRange(hfh, location, (char *)buffer, to_read);
 		hfh.buffer_available = 0;
 		hfh.buffer_idx = 0;
 		hfh.file_offset = location + nr_bytes;
@@ -548,14 +552,13 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 
 			// Bypass buffer if we read more than buffer size
 			if (to_read > new_buffer_available) {
-				GetRangeRequest(hfh, hfh.path, {}, location + buffer_offset, (char *)buffer + buffer_offset, to_read);
+				ReadRange(hfh, location + buffer_offset, (char *)buffer + buffer_offset, to_read);
 				hfh.buffer_available = 0;
 				hfh.buffer_idx = 0;
 				hfh.file_offset += to_read;
 				break;
 			} else {
-				GetRangeRequest(hfh, hfh.path, {}, hfh.file_offset, (char *)hfh.read_buffer.get(),
-				                new_buffer_available);
+				ReadRange(hfh, hfh.file_offset, (char *)hfh.read_buffer.get(), new_buffer_available);
 				hfh.buffer_available = new_buffer_available;
 				hfh.buffer_idx = 0;
 				hfh.buffer_start = hfh.file_offset;
@@ -565,6 +568,42 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 	}
 }
 
+void HTTPFileSystem::ReadRange(HTTPFileHandle &hfh, idx_t location, char *buffer, idx_t length) {
+	if (!hfh.block_cache) {
+		GetRangeRequest(hfh, hfh.path, {}, location, buffer, length);
+		return;
+	}
+	// read the range block-by-block through the block cache, downloading (and caching) the missing blocks
+	auto &cache = *hfh.block_cache;
+	auto end = location + length;
+	unique_ptr<char[]> block_buffer;
+	for (idx_t block_idx = location / HTTPBlockCache::BLOCK_SIZE; block_idx * HTTPBlockCache::BLOCK_SIZE < end;
+	     block_idx++) {
+		auto block_start = block_idx * HTTPBlockCache::BLOCK_SIZE;
+		auto block_end = MinValue<idx_t>(block_start + HTTPBlockCache::BLOCK_SIZE, hfh.length);
+		auto copy_start = MaxValue<idx_t>(location, block_start);
+		auto copy_end = MinValue<idx_t>(end, block_end);
+		// if we read the entire block we can read it directly into the output buffer
+		char *block_data;
+		if (copy_start == block_start && copy_end == block_end) {
+			block_data = buffer + (block_start - location);
+		} else {
+			if (!block_buffer) {
+				block_buffer = unique_ptr<char[]>(new char[HTTPBlockCache::BLOCK_SIZE]);
+			}
+			block_data = block_buffer.get();
+		}
+		auto key = HTTPBlockCache::GetBlockKey(hfh.path, hfh.block_cache_version, block_idx);
+		if (!cache.TryRead(key, block_data, block_end - block_start)) {
+			GetRangeRequest(hfh, hfh.path, {}, block_start, block_data, block_end - block_start);
+			cache.Write(key, block_data, block_end - block_start);
+		}
+		if (block_data == block_buffer.get()) {
+			memcpy(buffer + (copy_start - location), block_data + (copy_start - block_start), copy_end - copy_start);
+		}
+	}
+}
+
 int64_t HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	auto &hfh = (HTTPFileHandle &)handle;
 	idx_t max_read = hfh.length - hfh.file_offset;
@@ -632,6 +671,25 @@ optional_ptr<HTTPMetadataCache> HTTPFileSystem::GetGlobalCache() {
 	return global_metadata_cache.get();
 }
 
+shared_ptr<HTTPBlockCache> HTTPFileSystem::GetBlockCache(const HTTPParams &params) {
+	if (params.block_cache_directory.empty()) {
+		return nullptr;
+	}
+	lock_guard<mutex> lock(block_cache_lock);
+	auto entry = block_caches.find(params.block_cache_directory);
+	if (entry == block_caches.end()) {
+		// open the cache: the blocks cached in the directory by earlier instances are picked up again
+		auto block_cache = make_shared_ptr<HTTPBlockCache>(params.block_cache_directory, params.block_cache_max_size);
+		block_caches[params.block_cache_directory] = block_cache;
+		return block_cache;
+	}
+	auto &block_cache = entry->second;
+	if (block_cache->GetMaxSize() != params.block_cache_max_size) {
+		block_cache->SetMaxSize(params.block_cache_max_size);
+	}
+	return block_cache;
+}
+
 // Get either the local, global, or no cache depending on settings
 static optional_ptr<HTTPMetadataCache> TryGetMetadataCache(optional_ptr<FileOpener> opener, HTTPFileSystem &httpfs) {
 	auto db = FileOpener::TryGetDatabase(opener);
@@ -672,10 +730,12 @@ void HTTPFileHandle::Initialize(optional_ptr<FileOpener> opener) {
 		if (found) {
 			last_modified = value.last_modified;
 			length = value.length;
+			etag = value.etag;
 
 			if (flags.OpenForReading()) {
 				read_buffer = duckdb::unique_ptr<data_t[]>(new data_t[READ_BUFFER_LEN]);
 			}
+			InitializeBlockCache();
 			return;
 		}
 
@@ -782,9 +842,29 @@ void HTTPFileHandle::Initialize(optional_ptr<FileOpener> opener) {
 		last_modified = mktime(&tm);
 	}
 
+	if (res->headers.find("ETag") != res->headers.end()) {
+		etag = res->headers["ETag"];
+	}
+
 	if (should_write_cache) {
-		current_cache->Insert(path, {length, last_modified});
+		current_cache->Insert(path, {length, last_modified, etag});
+	}
+	InitializeBlockCache();
+}
+
+void HTTPFileHandle::InitializeBlockCache() {
+	if (!flags.OpenForReading() || flags.OpenForWriting() || cached_file_handle || length == 0) {
+		return;
+	}
+	// we can only cache blocks if we can tell whether the remote file changed
+	if (!etag.empty()) {
+		block_cache_version = "etag:" + etag;
+	} else if (last_modified != 0) {
+		block_cache_version = "modified:" + to_string(last_modified) + ":" + to_string(length);
+	} else {
+		return;
 	}
+	block_cache = file_system.Cast<HTTPFileSystem>().GetBlockCache(http_params);
 }
 
 unique_ptr<duckdb_httplib_openssl::Client> HTTPFileHandle::GetClient(optional_ptr<ClientContext> context) {
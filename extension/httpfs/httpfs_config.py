@@ -14,6 +14,7 @@ source_files = [
             'create_secret_functions.cpp',
             'crypto.cpp',
             'hffs.cpp',
+            'http_block_cache.cpp',
             'http_state.cpp',
             'httpfs.cpp',
             'httpfs_extension.cpp',
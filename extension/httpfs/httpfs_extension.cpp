@@ -39,6 +39,11 @@ static void LoadInternal(DatabaseInstance &instance) {
 	                          LogicalType::BOOLEAN, Value(false));
 	config.AddExtensionOption("ca_cert_file", "Path to a custom certificate file for self-signed certificates.",
 	                          LogicalType::VARCHAR, Value(""));
+	config.AddExtensionOption("http_block_cache_directory",
+	                          "Directory of the persistent cache of remote file blocks (empty to disable the cache)",
+	                          LogicalType::VARCHAR, Value(""));
+	config.AddExtensionOption("http_block_cache_max_size", "Maximum size of the persistent cache of remote file blocks",
+	                          LogicalType::VARCHAR, Value("10GB"));
 	// Global S3 config
 	config.AddExtensionOption("s3_region", "S3 Region", LogicalType::VARCHAR, Value("us-east-1"));
 	config.AddExtensionOption("s3_access_key_id", "S3 Access Key ID", LogicalType::VARCHAR);
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+
+//! Persistent cache of byte ranges of remote files, stored as files in a local directory
+//! Remote files are cached in aligned blocks of BLOCK_SIZE bytes. Every block is content-addressed by the URL, the
+//! version of the remote file (its ETag, or its last modified time and length) and the block index. As the cached
+//! blocks are plain files, the cache is shared between connections and survives restarts. The directory is only
+//! listed when the cache is opened: afterwards the blocks are tracked in an in-memory LRU list.
+class HTTPBlockCache {
+public:
+	//! The size of the cached blocks
+	static constexpr idx_t BLOCK_SIZE = 1 << 20;
+	static constexpr const char *BLOCK_EXTENSION = ".block";
+	//! Blocks are written to "<block>.tmp.<uuid>" first and then moved in place
+	static constexpr const char *TEMP_EXTENSION = ".tmp.";
+
+public:
+	HTTPBlockCache(string directory, idx_t max_size);
+
+	//! Reads a cached block into "buffer", returns false if the block is not (or no longer) cached
+	bool TryRead(const string &key, char *buffer, idx_t size);
+	//! Stores a block in the cache, evicting the least recently used blocks if the cache exceeds its maximum size
+	//! Failing to store a block is not an error: the cache is best-effort
+	void Write(const string &key, const char *buffer, idx_t size);
+
+	//! Returns the key of the block of the given (version of the) remote file
+	static string GetBlockKey(const string &url, const string &version, idx_t block_idx);
+
+	const string &GetDirectory() const {
+		return directory;
+	}
+	idx_t GetMaxSize();
+	//! Changes the maximum size of the cache, evicting blocks if the cache no longer fits
+	void SetMaxSize(idx_t max_size);
+
+private:
+	struct CachedBlock {
+		idx_t size;
+		//! The position of the block in the LRU list
+		list<string>::iterator lru_position;
+	};
+
+	//! Loads the blocks that were cached by previous instances, and removes temporary files left behind by writers
+	//! that did not finish (e.g. because the process was killed)
+	void LoadExistingBlocks();
+	//! Adds a block as the most recently used block (requires the lock to be held)
+	void AddBlock(const string &key, idx_t size);
+	//! Removes a block from the in-memory index (requires the lock to be held)
+	void RemoveBlock(unordered_map<string, CachedBlock>::iterator entry);
+	//! Evicts blocks until "required_space" additional bytes fit in the cache (requires the lock to be held)
+	void EvictBlocks(idx_t required_space);
+	string GetBlockPath(const string &key) const;
+
+private:
+	//! The local file system the blocks are stored in
+	unique_ptr<FileSystem> fs;
+	//! The directory of the cache
+	string directory;
+	//! The maximum total size of the cached blocks
+	idx_t max_size;
+	//! Lock for the cached blocks
+	mutex lock;
+	//! The cached blocks
+	unordered_map<string, CachedBlock> blocks;
+	//! The keys of the cached blocks, from the most to the least recently used
+	list<string> lru_list;
+	//! The total size of the cached blocks
+	idx_t current_size;
+};
+
+} // namespace duckdb
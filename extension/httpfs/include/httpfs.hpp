@@ -7,6 +7,7 @@
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/main/client_data.hpp"
 #include "http_metadata_cache.hpp"
+#include "http_block_cache.hpp"
 
 namespace duckdb_httplib_openssl {
 struct Response;
@@ -45,6 +46,7 @@ struct HTTPParams {
 	static constexpr bool DEFAULT_KEEP_ALIVE = true;
 	static constexpr bool DEFAULT_ENABLE_SERVER_CERT_VERIFICATION = false;
 	static constexpr uint64_t DEFAULT_HF_MAX_PER_PAGE = 0;
+	static constexpr idx_t DEFAULT_BLOCK_CACHE_MAX_SIZE = 10737418240ULL; // 10GB
 
 	uint64_t timeout = DEFAULT_TIMEOUT;
 	uint64_t retries = DEFAULT_RETRIES;
@@ -54,6 +56,9 @@ struct HTTPParams {
 	bool keep_alive = DEFAULT_KEEP_ALIVE;
 	bool enable_server_cert_verification = DEFAULT_ENABLE_SERVER_CERT_VERIFICATION;
 	idx_t hf_max_per_page = DEFAULT_HF_MAX_PER_PAGE;
+	//! The directory of the persistent block cache (empty if disabled)
+	string block_cache_directory;
+	idx_t block_cache_max_size = DEFAULT_BLOCK_CACHE_MAX_SIZE;
 
 	string ca_cert_file;
 	string http_proxy;
@@ -102,6 +107,12 @@ public:
 	// When using full file download, the full file will be written to a cached file handle
 	unique_ptr<CachedFileHandle> cached_file_handle;
 
+	// The ETag of the file (if the server provided one)
+	string etag;
+	// The persistent block cache that reads go through (if enabled), and the version of the file used in its keys
+	shared_ptr<HTTPBlockCache> block_cache;
+	string block_cache_version;
+
 	// Read info
 	idx_t buffer_available;
 	idx_t buffer_idx;
@@ -127,6 +138,8 @@ public:
 	}
 
 protected:
+	//! Sets up reading through the persistent block cache, if it is enabled and the file version is known
+	void InitializeBlockCache();
 	//! Create a new Client
 	virtual unique_ptr<duckdb_httplib_openssl::Client> CreateClient(optional_ptr<ClientContext> client_context);
 };
@@ -191,11 +204,16 @@ public:
 	static void Verify();
 
 	optional_ptr<HTTPMetadataCache> GetGlobalCache();
+	//! Get the persistent block cache for the given settings (if enabled)
+	shared_ptr<HTTPBlockCache> GetBlockCache(const HTTPParams &params);
 
 protected:
 	virtual duckdb::unique_ptr<HTTPFileHandle> CreateHandle(const string &path, FileOpenFlags flags,
 	                                                        optional_ptr<FileOpener> opener);
 
+	// Reads a range of the file, going through the persistent block cache if it is enabled
+	void ReadRange(HTTPFileHandle &hfh, idx_t location, char *buffer, idx_t length);
+
 	static duckdb::unique_ptr<ResponseWrapper>
 	RunRequestWithRetry(const std::function<duckdb_httplib_openssl::Result(void)> &request, string &url, string method,
 	                    const HTTPParams &params, const std::function<void(void)> &retry_cb = {});
@@ -204,6 +222,9 @@ private:
 	// Global cache
 	mutex global_cache_lock;
 	duckdb::unique_ptr<HTTPMetadataCache> global_metadata_cache;
+	// Persistent block caches, by directory
+	mutex block_cache_lock;
+	unordered_map<string, shared_ptr<HTTPBlockCache>> block_caches;
 };
 
 } // namespace duckdb
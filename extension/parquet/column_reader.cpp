@@ -153,6 +153,12 @@ void ColumnReader::RegisterPrefetch(ThriftFileTransport &transport, bool allow_m
 	}
 }
 
+void ColumnReader::RegisterReadAhead(ThriftFileTransport &transport, const vector<ColumnChunk> &columns) {
+	D_ASSERT(file_idx < columns.size());
+	auto &column_chunk = columns[file_idx];
+	transport.RegisterReadAhead(ChunkFileOffset(column_chunk), column_chunk.meta_data.total_compressed_size);
+}
+
 uint64_t ColumnReader::TotalCompressedSize() {
 	if (!chunk) {
 		return 0;
@@ -168,14 +174,18 @@ idx_t ColumnReader::FileOffset() const {
 	if (!chunk) {
 		throw std::runtime_error("FileOffset called on ColumnReader with no chunk");
 	}
+	return ChunkFileOffset(*chunk);
+}
+
+idx_t ColumnReader::ChunkFileOffset(const ColumnChunk &column_chunk) {
 	auto min_offset = NumericLimits<idx_t>::Maximum();
-	if (chunk->meta_data.__isset.dictionary_page_offset) {
-		min_offset = MinValue<idx_t>(min_offset, chunk->meta_data.dictionary_page_offset);
+	if (column_chunk.meta_data.__isset.dictionary_page_offset) {
+		min_offset = MinValue<idx_t>(min_offset, column_chunk.meta_data.dictionary_page_offset);
 	}
-	if (chunk->meta_data.__isset.index_page_offset) {
-		min_offset = MinValue<idx_t>(min_offset, chunk->meta_data.index_page_offset);
+	if (column_chunk.meta_data.__isset.index_page_offset) {
+		min_offset = MinValue<idx_t>(min_offset, column_chunk.meta_data.index_page_offset);
 	}
-	min_offset = MinValue<idx_t>(min_offset, chunk->meta_data.data_page_offset);
+	min_offset = MinValue<idx_t>(min_offset, column_chunk.meta_data.data_page_offset);
 
 	return min_offset;
 }
@@ -238,6 +248,14 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChun
 		chunk_read_offset = chunk->meta_data.dictionary_page_offset;
 	}
 	group_rows_available = chunk->meta_data.num_values;
+	page_rows_available = 0;
+	// skips that were registered for the previous column chunk do not carry over to this one
+	pending_skips = 0;
+	page_locations.clear();
+}
+
+void ColumnReader::SetPageLocations(vector<PageLocation> page_locations_p) {
+	page_locations = std::move(page_locations_p);
 }
 
 void ColumnReader::PrepareRead(parquet_filter_t &filter) {
@@ -603,9 +621,100 @@ void ColumnReader::Skip(idx_t num_values) {
 	pending_skips += num_values;
 }
 
+idx_t ColumnReader::SkipPages(idx_t num_values) {
+	D_ASSERT(!page_locations.empty() && !HasRepeats());
+	// without repeats, every value is a row
+	auto current_row = NumericCast<idx_t>(chunk->meta_data.num_values) - group_rows_available;
+	auto target_row = current_row + num_values;
+
+	// find the last page that starts at or before the target row
+	idx_t page_idx = page_locations.size();
+	while (page_idx > 0 && NumericCast<idx_t>(page_locations[page_idx - 1].first_row_index) > target_row) {
+		page_idx--;
+	}
+	if (page_idx == 0 || NumericCast<idx_t>(page_locations[page_idx - 1].first_row_index) <= current_row) {
+		// the target row is in the current page
+		return 0;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	auto first_page_offset = NumericCast<idx_t>(page_locations[0].offset);
+	if (chunk_read_offset < first_page_offset) {
+		// we have not read the dictionary page yet - later pages might need it
+		trans.SetLocation(chunk_read_offset);
+		while (trans.GetLocation() < first_page_offset) {
+			PrepareRead(none_filter);
+		}
+	}
+	auto &page_location = page_locations[page_idx - 1];
+	chunk_read_offset = NumericCast<idx_t>(page_location.offset);
+	trans.SetLocation(chunk_read_offset);
+	page_rows_available = 0;
+
+	auto skipped_rows = NumericCast<idx_t>(page_location.first_row_index) - current_row;
+	group_rows_available -= skipped_rows;
+	return skipped_rows;
+}
+
+idx_t ColumnReader::SkipDataPages(idx_t num_values) {
+	D_ASSERT(!HasRepeats());
+	idx_t skipped_rows = 0;
+	if (page_rows_available > 0) {
+		if (num_values < page_rows_available) {
+			// the skip ends in the current page
+			return 0;
+		}
+		// the remainder of the current page is skipped - we can drop it without decoding it
+		skipped_rows = page_rows_available;
+		page_rows_available = 0;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	while (skipped_rows < num_values && skipped_rows < group_rows_available) {
+		auto page_offset = chunk_read_offset;
+		trans.SetLocation(page_offset);
+		PageHeader page_hdr;
+		reader.Read(page_hdr, *protocol);
+
+		idx_t page_rows;
+		if (page_hdr.type == PageType::DATA_PAGE) {
+			page_rows = NumericCast<idx_t>(page_hdr.data_page_header.num_values);
+		} else if (page_hdr.type == PageType::DATA_PAGE_V2) {
+			page_rows = NumericCast<idx_t>(page_hdr.data_page_header_v2.num_values);
+		} else if (page_hdr.type == PageType::DICTIONARY_PAGE) {
+			// later pages might need the dictionary - read it
+			trans.SetLocation(page_offset);
+			PrepareRead(none_filter);
+			chunk_read_offset = trans.GetLocation();
+			continue;
+		} else {
+			// other page types are handled by the regular read path
+			break;
+		}
+		if (skipped_rows + page_rows > num_values) {
+			// the skip ends in this page - it has to be decoded
+			break;
+		}
+		// jump over the (compressed) page data
+		chunk_read_offset = trans.GetLocation() + NumericCast<idx_t>(page_hdr.compressed_page_size);
+		skipped_rows += page_rows;
+	}
+	trans.SetLocation(chunk_read_offset);
+	group_rows_available -= skipped_rows;
+	return skipped_rows;
+}
+
 void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	pending_skips -= num_values;
 
+	if (!page_locations.empty() && !HasRepeats()) {
+		// pages that are skipped entirely do not have to be read at all
+		num_values -= SkipPages(num_values);
+	}
+	if (num_values > 0 && !HasRepeats() && !reader.parquet_options.encryption_config) {
+		// pages that are skipped entirely do not have to be decompressed or decoded either
+		// encrypted pages carry their own length, so we can only jump over unencrypted pages
+		num_values -= SkipDataPages(num_values);
+	}
+
 	dummy_define.zero();
 	dummy_repeat.zero();
 
@@ -1212,6 +1321,12 @@ void StructColumnReader::RegisterPrefetch(ThriftFileTransport &transport, bool a
 	}
 }
 
+void StructColumnReader::RegisterReadAhead(ThriftFileTransport &transport, const vector<ColumnChunk> &columns) {
+	for (auto &child : child_readers) {
+		child->RegisterReadAhead(transport, columns);
+	}
+}
+
 uint64_t StructColumnReader::TotalCompressedSize() {
 	uint64_t size = 0;
 	for (auto &child : child_readers) {
@@ -30,12 +30,16 @@ namespace duckdb {
 using namespace duckdb_parquet; // NOLINT
 using namespace duckdb_miniz;   // NOLINT
 
+using duckdb_parquet::format::BoundaryOrder;
+using duckdb_parquet::format::ColumnIndex;
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::ConvertedType;
 using duckdb_parquet::format::Encoding;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::FileMetaData;
+using duckdb_parquet::format::OffsetIndex;
 using duckdb_parquet::format::PageHeader;
+using duckdb_parquet::format::PageLocation;
 using duckdb_parquet::format::PageType;
 using ParquetRowGroup = duckdb_parquet::format::RowGroup;
 using duckdb_parquet::format::Type;
@@ -88,6 +92,9 @@ string ColumnWriterStatistics::GetMaxValue() {
 	return string();
 }
 
+void ColumnWriterStatistics::Merge(ColumnWriterStatistics &other) {
+}
+
 //===--------------------------------------------------------------------===//
 // RleBpEncoder
 //===--------------------------------------------------------------------===//
@@ -334,6 +341,8 @@ struct PageWriteInformation {
 	PageHeader page_header;
 	unique_ptr<MemoryStream> temp_writer;
 	unique_ptr<ColumnWriterPageState> page_state;
+	//! The statistics of the values in this page (merged into the column statistics when the page is flushed)
+	unique_ptr<ColumnWriterStatistics> page_stats;
 	idx_t write_page_idx = 0;
 	idx_t write_count = 0;
 	idx_t max_write_count = 0;
@@ -355,6 +364,8 @@ public:
 	vector<PageInformation> page_info;
 	vector<PageWriteInformation> write_info;
 	unique_ptr<ColumnWriterStatistics> stats_state;
+	//! The Bloom filter of the column chunk (if any)
+	unique_ptr<ParquetBloomFilter> bloom_filter;
 	idx_t current_page = 0;
 };
 
@@ -371,9 +382,6 @@ public:
 
 	~BasicColumnWriter() override = default;
 
-	//! We limit the uncompressed page size to 100MB
-	//! The max size in Parquet is 2GB, but we choose a more conservative limit
-	static constexpr const idx_t MAX_UNCOMPRESSED_PAGE_SIZE = 100000000;
 	//! Dictionary pages must be below 2GB. Unlike data pages, there's only one dictionary page.
 	//! For this reason we go with a much higher, but still a conservative upper bound of 1GB;
 	static constexpr const idx_t MAX_UNCOMPRESSED_DICT_PAGE_SIZE = 1e9;
@@ -425,7 +433,16 @@ protected:
 	void WriteDictionary(BasicColumnWriterState &state, unique_ptr<MemoryStream> temp_writer, idx_t row_count);
 	virtual void FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats);
 
+	//! Whether or not this writer can write a Bloom filter for its values
+	virtual bool SupportsBloomFilter() const {
+		return false;
+	}
+	//! Inserts the hashes of the plain-encoded (non-NULL) values of the vector into the Bloom filter
+	virtual void UpdateBloomFilter(ParquetBloomFilter &bloom_filter, Vector &vector, idx_t count);
+
 	void SetParquetStatistics(BasicColumnWriterState &state, duckdb_parquet::format::ColumnChunk &column);
+	//! Register the page index (column index and offset index) of the column chunk with the writer
+	void WritePageIndex(BasicColumnWriterState &state, const vector<PageLocation> &page_locations);
 	void RegisterToRowGroup(duckdb_parquet::format::RowGroup &row_group);
 };
 
@@ -475,7 +492,7 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 		}
 		if (validity.RowIsValid(vector_index)) {
 			page_info.estimated_page_size += GetRowSize(vector, vector_index, state);
-			if (page_info.estimated_page_size >= MAX_UNCOMPRESSED_PAGE_SIZE) {
+			if (page_info.estimated_page_size >= writer.PageSizeBytes()) {
 				PageInformation new_info;
 				new_info.offset = page_info.offset + page_info.row_count;
 				state.page_info.push_back(new_info);
@@ -495,6 +512,14 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 
 	// set up the page write info
 	state.stats_state = InitializeStatsState();
+	if (max_repeat == 0 && SupportsBloomFilter() && writer.WriteBloomFilter(schema_path)) {
+		auto &column_chunk = state.row_group.columns[state.col_idx];
+		auto num_distinct_values = HasDictionary(state)
+		                               ? DictionarySize(state)
+		                               : NumericCast<idx_t>(column_chunk.meta_data.num_values) - state.null_count;
+		state.bloom_filter =
+		    make_uniq<ParquetBloomFilter>(num_distinct_values, writer.BloomFilterFalsePositiveRatio());
+	}
 	for (idx_t page_idx = 0; page_idx < state.page_info.size(); page_idx++) {
 		auto &page_info = state.page_info[page_idx];
 		if (page_info.row_count == 0) {
@@ -520,6 +545,7 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 		write_info.write_count = page_info.empty_count;
 		write_info.max_write_count = page_info.row_count;
 		write_info.page_state = InitializePageState(state);
+		write_info.page_stats = InitializeStatsState();
 
 		write_info.compressed_size = 0;
 		write_info.compressed_data = nullptr;
@@ -590,6 +616,7 @@ void BasicColumnWriter::FlushPage(BasicColumnWriterState &state) {
 	auto &hdr = write_info.page_header;
 
 	FlushPageState(temp_writer, write_info.page_state.get());
+	state.stats_state->Merge(*write_info.page_stats);
 
 	// now that we have finished writing the data we know the uncompressed size
 	if (temp_writer.GetPosition() > idx_t(NumericLimits<int32_t>::Maximum())) {
@@ -622,6 +649,9 @@ idx_t BasicColumnWriter::GetRowSize(const Vector &vector, const idx_t index,
 
 void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t count) {
 	auto &state = state_p.Cast<BasicColumnWriterState>();
+	if (state.bloom_filter) {
+		UpdateBloomFilter(*state.bloom_filter, vector, count);
+	}
 
 	idx_t remaining = count;
 	idx_t offset = 0;
@@ -634,7 +664,7 @@ void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 		idx_t write_count = MinValue<idx_t>(remaining, write_info.max_write_count - write_info.write_count);
 		D_ASSERT(write_count > 0);
 
-		WriteVector(temp_writer, state.stats_state.get(), write_info.page_state.get(), vector, offset,
+		WriteVector(temp_writer, write_info.page_stats.get(), write_info.page_state.get(), vector, offset,
 		            offset + write_count);
 
 		write_info.write_count += write_count;
@@ -710,6 +740,7 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 
 	// write the individual pages to disk
 	idx_t total_uncompressed_size = 0;
+	vector<PageLocation> page_locations;
 	for (auto &write_info : state.write_info) {
 		// set the data page offset whenever we see the *first* data page
 		if (column_chunk.meta_data.data_page_offset == 0 && (write_info.page_header.type == PageType::DATA_PAGE ||
@@ -724,12 +755,61 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 		total_uncompressed_size += column_writer.GetTotalWritten() - header_start_offset;
 		total_uncompressed_size += write_info.page_header.uncompressed_page_size;
 		writer.WriteData(write_info.compressed_data, write_info.compressed_size);
+
+		if (write_info.page_header.type == PageType::DATA_PAGE) {
+			PageLocation page_location;
+			page_location.offset = NumericCast<int64_t>(header_start_offset);
+			page_location.compressed_page_size =
+			    NumericCast<int32_t>(column_writer.GetTotalWritten() - header_start_offset);
+			page_location.first_row_index = NumericCast<int64_t>(state.page_info[page_locations.size()].offset);
+			page_locations.push_back(page_location);
+		}
+	}
+	WritePageIndex(state, page_locations);
+	if (state.bloom_filter) {
+		writer.RegisterBloomFilter(state.col_idx, std::move(state.bloom_filter));
 	}
 	column_chunk.meta_data.total_compressed_size =
 	    UnsafeNumericCast<int64_t>(column_writer.GetTotalWritten() - start_offset);
 	column_chunk.meta_data.total_uncompressed_size = UnsafeNumericCast<int64_t>(total_uncompressed_size);
 }
 
+void BasicColumnWriter::WritePageIndex(BasicColumnWriterState &state, const vector<PageLocation> &page_locations) {
+	// a page index only pays off if there are multiple pages to choose from
+	// page locations refer to row indexes, so pages of repeated columns would have to start at row boundaries
+	if (page_locations.size() <= 1 || max_repeat > 0) {
+		return;
+	}
+	D_ASSERT(page_locations.size() == state.page_info.size());
+	auto offset_index = make_uniq<OffsetIndex>();
+	offset_index->page_locations = page_locations;
+
+	// the column index requires statistics for every page that has values
+	auto column_index = make_uniq<ColumnIndex>();
+	column_index->boundary_order = BoundaryOrder::UNORDERED;
+	column_index->__isset.null_counts = true;
+	for (idx_t page_idx = 0; page_idx < state.page_info.size(); page_idx++) {
+		auto &page_info = state.page_info[page_idx];
+		auto &page_stats = *state.write_info[state.write_info.size() - state.page_info.size() + page_idx].page_stats;
+		int64_t null_count = 0;
+		for (idx_t i = page_info.offset; i < page_info.offset + page_info.row_count; i++) {
+			if (!state.definition_levels.empty() && state.definition_levels[i] != max_define) {
+				null_count++;
+			}
+		}
+		bool null_page = idx_t(null_count) == page_info.row_count;
+		if (!null_page && !page_stats.HasStats()) {
+			column_index.reset();
+			break;
+		}
+		column_index->null_pages.push_back(null_page);
+		column_index->min_values.push_back(null_page ? string() : page_stats.GetMinValue());
+		column_index->max_values.push_back(null_page ? string() : page_stats.GetMaxValue());
+		column_index->null_counts.push_back(null_count);
+	}
+	writer.RegisterPageIndex(state.col_idx, std::move(column_index), std::move(offset_index));
+}
+
 void BasicColumnWriter::FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats) {
 	throw InternalException("This page does not have a dictionary");
 }
@@ -738,6 +818,10 @@ idx_t BasicColumnWriter::DictionarySize(BasicColumnWriterState &state) {
 	throw InternalException("This page does not have a dictionary");
 }
 
+void BasicColumnWriter::UpdateBloomFilter(ParquetBloomFilter &bloom_filter, Vector &vector, idx_t count) {
+	throw InternalException("This column writer does not support Bloom filters");
+}
+
 void BasicColumnWriter::WriteDictionary(BasicColumnWriterState &state, unique_ptr<MemoryStream> temp_writer,
                                         idx_t row_count) {
 	D_ASSERT(temp_writer);
@@ -797,6 +881,18 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string((char *)&max, sizeof(T)) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<NumericStatisticsState<SRC, T, OP>>();
+		if (!other.HasStats()) {
+			return;
+		}
+		if (LessThan::Operation(other.min, min)) {
+			min = other.min;
+		}
+		if (GreaterThan::Operation(other.max, max)) {
+			max = other.max;
+		}
+	}
 };
 
 struct BaseParquetOperator {
@@ -923,6 +1019,22 @@ public:
 	idx_t GetRowSize(const Vector &vector, const idx_t index, const BasicColumnWriterState &state) const override {
 		return sizeof(TGT);
 	}
+
+	bool SupportsBloomFilter() const override {
+		return true;
+	}
+
+	void UpdateBloomFilter(ParquetBloomFilter &bloom_filter, Vector &input_column, idx_t count) override {
+		auto &mask = FlatVector::Validity(input_column);
+		const auto *ptr = FlatVector::GetData<SRC>(input_column);
+		for (idx_t r = 0; r < count; r++) {
+			if (!mask.RowIsValid(r)) {
+				continue;
+			}
+			TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+			bloom_filter.FilterInsert(ParquetBloomFilter::Hash(const_data_ptr_cast(&target_value), sizeof(TGT)));
+		}
+	}
 };
 
 //===--------------------------------------------------------------------===//
@@ -953,6 +1065,11 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string(const_char_ptr_cast(&max), sizeof(bool)) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<BooleanStatisticsState>();
+		min = min && other.min;
+		max = max || other.max;
+	}
 };
 
 class BooleanWriterPageState : public ColumnWriterPageState {
@@ -1084,6 +1201,13 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? GetStats(max) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<FixedDecimalStatistics>();
+		if (other.HasStats()) {
+			Update(other.min);
+			Update(other.max);
+		}
+	}
 };
 
 class FixedDecimalColumnWriter : public BasicColumnWriter {
@@ -1266,6 +1390,29 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? max : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<StringStatisticsState>();
+		if (values_too_big) {
+			return;
+		}
+		if (other.values_too_big) {
+			values_too_big = true;
+			has_stats = false;
+			min = string();
+			max = string();
+			return;
+		}
+		if (!other.has_stats) {
+			return;
+		}
+		if (!has_stats || LessThan::Operation(string_t(other.min), string_t(min))) {
+			min = other.min;
+		}
+		if (!has_stats || GreaterThan::Operation(string_t(other.max), string_t(max))) {
+			max = other.max;
+		}
+		has_stats = true;
+	}
 };
 
 class StringColumnWriterState : public BasicColumnWriterState {
@@ -1504,6 +1651,22 @@ public:
 		}
 	}
 
+	bool SupportsBloomFilter() const override {
+		return true;
+	}
+
+	void UpdateBloomFilter(ParquetBloomFilter &bloom_filter, Vector &input_column, idx_t count) override {
+		auto &mask = FlatVector::Validity(input_column);
+		auto strings = FlatVector::GetData<string_t>(input_column);
+		for (idx_t r = 0; r < count; r++) {
+			if (!mask.RowIsValid(r)) {
+				continue;
+			}
+			bloom_filter.FilterInsert(
+			    ParquetBloomFilter::Hash(const_data_ptr_cast(strings[r].GetData()), strings[r].GetSize()));
+		}
+	}
+
 private:
 	bool WontUseDictionary(StringColumnWriterState &state) const {
 		return state.estimated_dict_page_size > MAX_UNCOMPRESSED_DICT_PAGE_SIZE ||
@@ -33,6 +33,7 @@ using duckdb_parquet::format::ColumnChunk;
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::PageHeader;
+using duckdb_parquet::format::PageLocation;
 using duckdb_parquet::format::SchemaElement;
 using duckdb_parquet::format::Type;
 
@@ -62,13 +63,19 @@ public:
 	idx_t MaxRepeat() const;
 
 	virtual idx_t FileOffset() const;
+	//! The offset of the first page of a column chunk
+	static idx_t ChunkFileOffset(const ColumnChunk &column_chunk);
 	virtual uint64_t TotalCompressedSize();
 	virtual idx_t GroupRowsAvailable();
 
 	// register the range this reader will touch for prefetching
 	virtual void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge);
+	// register the range this reader will touch in another row group for reading ahead in the background
+	virtual void RegisterReadAhead(ThriftFileTransport &transport, const vector<ColumnChunk> &columns);
 
 	virtual unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const vector<ColumnChunk> &columns);
+	// set the page locations of the current column chunk (from the offset index), so skips can jump over whole pages
+	virtual void SetPageLocations(vector<PageLocation> page_locations);
 
 	template <class VALUE_TYPE, class CONVERSION>
 	void PlainTemplated(shared_ptr<ByteBuffer> plain_data, uint8_t *defines, uint64_t num_values,
@@ -168,6 +175,11 @@ private:
 	void PreparePageV2(PageHeader &page_hdr);
 	void DecompressInternal(CompressionCodec::type codec, const_data_ptr_t src, idx_t src_size, data_ptr_t dst,
 	                        idx_t dst_size);
+	//! Jump over the pages that are skipped entirely, returns the number of rows that were skipped
+	idx_t SkipPages(idx_t num_values);
+	//! Skip the pages that only contain skipped rows based on their page headers, without decompressing them
+	//! Returns the number of rows that were skipped
+	idx_t SkipDataPages(idx_t num_values);
 
 	const duckdb_parquet::format::ColumnChunk *chunk = nullptr;
 
@@ -175,6 +187,8 @@ private:
 	idx_t page_rows_available;
 	idx_t group_rows_available;
 	idx_t chunk_read_offset;
+	//! The page locations of the current column chunk (if set)
+	vector<PageLocation> page_locations;
 
 	shared_ptr<ResizeableBuffer> block;
 
@@ -49,6 +49,8 @@ public:
 	virtual string GetMax();
 	virtual string GetMinValue();
 	virtual string GetMaxValue();
+	//! Merge the statistics of another state (of the same type) into this state
+	virtual void Merge(ColumnWriterStatistics &other);
 
 public:
 	template <class TARGET>
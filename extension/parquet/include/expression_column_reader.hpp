@@ -47,6 +47,12 @@ public:
 	void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) override {
 		child_reader->RegisterPrefetch(transport, allow_merge);
 	}
+	void RegisterReadAhead(ThriftFileTransport &transport, const vector<ColumnChunk> &columns) override {
+		child_reader->RegisterReadAhead(transport, columns);
+	}
+	void SetPageLocations(vector<PageLocation> page_locations) override {
+		child_reader->SetPageLocations(std::move(page_locations));
+	}
 };
 
 } // namespace duckdb
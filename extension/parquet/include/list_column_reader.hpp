@@ -41,6 +41,9 @@ public:
 	void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) override {
 		child_column_reader->RegisterPrefetch(transport, allow_merge);
 	}
+	void RegisterReadAhead(ThriftFileTransport &transport, const vector<ColumnChunk> &columns) override {
+		child_column_reader->RegisterReadAhead(transport, columns);
+	}
 
 private:
 	unique_ptr<ColumnReader> child_column_reader;
@@ -42,10 +42,15 @@ class ClientContext;
 class BaseStatistics;
 class TableFilterSet;
 class ParquetEncryptionConfig;
+class StructColumnReader;
 
 struct ParquetReaderPrefetchConfig {
 	// Percentage of data in a row group span that should be scanned for enabling whole group prefetch
 	static constexpr double WHOLE_GROUP_PREFETCH_MINIMUM_SCAN = 0.95;
+	// Maximum amount of data of a row group that is read ahead in the background while decoding another row group
+	static constexpr idx_t MAXIMUM_READ_AHEAD_SIZE = 128ULL * 1024ULL * 1024ULL;
+	// Maximum number of row groups that are read ahead at the same time by a scan
+	static constexpr idx_t MAXIMUM_READ_AHEAD_GROUPS = 2;
 };
 
 struct ParquetReaderScanState {
@@ -64,6 +69,12 @@ struct ParquetReaderScanState {
 
 	bool prefetch_mode = false;
 	bool current_group_prefetched = false;
+	// The row groups that are being read ahead in the background, in the order they will be scanned
+	vector<idx_t> read_ahead_groups;
+	// The row ranges [start, end) of the current group that can pass the filters according to the page index
+	// empty if the page index does not rule out any rows
+	vector<pair<idx_t, idx_t>> row_ranges;
+	idx_t current_row_range = 0;
 };
 
 struct ParquetColumnDefinition {
@@ -145,6 +156,9 @@ public:
 public:
 	void InitializeScan(ClientContext &context, ParquetReaderScanState &state, vector<idx_t> groups_to_read);
 	void Scan(ParquetReaderScanState &state, DataChunk &output);
+	//! Start reading the projected columns of a row group that this scan state will scan next in the background
+	//! Returns false if the row group is not read ahead
+	bool ReadAheadGroup(ClientContext &context, ParquetReaderScanState &state, idx_t group_idx);
 
 	static unique_ptr<ParquetUnionData> StoreUnionReader(unique_ptr<ParquetReader> reader_p, idx_t file_idx) {
 		auto result = make_uniq<ParquetUnionData>();
@@ -210,6 +224,14 @@ private:
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	//! Whether the statistics of a row group rule out all of its rows for the filters of the scan
+	bool GroupStatisticsExclude(StructColumnReader &root_reader, idx_t group_idx);
+	//! Whether the scan has a filter on the given column
+	bool ColumnHasFilter(idx_t col_idx);
+	// Use the page index of the current group to find the row ranges that can pass the filters
+	void PreparePageIndex(ParquetReaderScanState &state);
+	// Use the Bloom filter of a column chunk of the current group to check if the filter can be satisfied at all
+	bool BloomFilterExcludes(ParquetReaderScanState &state, ColumnReader &column_reader, const TableFilter &filter);
 	LogicalType DeriveLogicalType(const SchemaElement &s_ele);
 
 	template <typename... Args>
@@ -13,6 +13,8 @@ using duckdb_parquet::format::SchemaElement;
 
 struct LogicalType;
 class ColumnReader;
+class ParquetBloomFilter;
+class TableFilter;
 
 struct ParquetStatisticsUtils {
 
@@ -21,6 +23,55 @@ struct ParquetStatisticsUtils {
 
 	static Value ConvertValue(const LogicalType &type, const duckdb_parquet::format::SchemaElement &schema_ele,
 	                          const std::string &stats);
+
+	//! Whether or not the filter contains equality comparisons that can be checked against a Bloom filter
+	static bool BloomFilterSupported(const TableFilter &filter);
+	//! Returns true if the Bloom filter proves that no value in the column chunk can match the filter
+	static bool BloomFilterExcludes(const ColumnReader &reader, const TableFilter &filter,
+	                                const ParquetBloomFilter &bloom_filter);
+};
+
+//! A split block Bloom filter, as defined by the Parquet specification
+//! The filter consists of 256-bit blocks of eight 32-bit words, a key sets one bit in every word of a single block
+class ParquetBloomFilter {
+public:
+	static constexpr const idx_t WORDS_PER_BLOCK = 8;
+	static constexpr const idx_t BYTES_PER_BLOCK = WORDS_PER_BLOCK * sizeof(uint32_t);
+	//! The maximum size of a Bloom filter (128MB)
+	static constexpr const idx_t MAX_BYTES = idx_t(1) << 27;
+
+public:
+	//! Creates an empty Bloom filter of the specified size (a multiple of BYTES_PER_BLOCK)
+	explicit ParquetBloomFilter(idx_t num_bytes);
+	//! Creates an empty Bloom filter sized for the expected number of distinct values and false positive ratio
+	ParquetBloomFilter(idx_t num_distinct_values, double false_positive_ratio);
+
+	//! Computes the hash of a plain-encoded value (XXH64 with seed 0)
+	static uint64_t Hash(const_data_ptr_t data, idx_t size);
+
+	void FilterInsert(uint64_t hash);
+	bool FilterCheck(uint64_t hash) const;
+
+	data_ptr_t GetData() {
+		return data_ptr_cast(blocks.get());
+	}
+	const_data_ptr_t GetData() const {
+		return const_data_ptr_cast(blocks.get());
+	}
+	idx_t SizeInBytes() const {
+		return block_count * BYTES_PER_BLOCK;
+	}
+
+private:
+	idx_t GetBlockIndex(uint64_t hash) const {
+		return ((hash >> 32) * block_count) >> 32;
+	}
+
+private:
+	//! The number of blocks
+	idx_t block_count;
+	//! The words of all blocks
+	unsafe_unique_array<uint32_t> blocks;
 };
 
 } // namespace duckdb
@@ -20,6 +20,7 @@
 #endif
 
 #include "column_writer.hpp"
+#include "parquet_statistics.hpp"
 #include "parquet_types.h"
 #include "geo_parquet.hpp"
 #include "thrift/protocol/TCompactProtocol.h"
@@ -38,6 +39,21 @@ struct PreparedRowGroup {
 	vector<shared_ptr<StringHeap>> heaps;
 };
 
+//! The page index (column index and offset index) of a column chunk, written before the footer
+struct ColumnChunkPageIndex {
+	idx_t row_group_idx;
+	idx_t column_idx;
+	//! The column index (page statistics) - can be nullptr if not all pages have statistics
+	unique_ptr<duckdb_parquet::format::ColumnIndex> column_index;
+	unique_ptr<duckdb_parquet::format::OffsetIndex> offset_index;
+};
+
+//! The Bloom filter of a column chunk, written after the column chunks of its row group
+struct ColumnChunkBloomFilter {
+	idx_t column_idx;
+	unique_ptr<ParquetBloomFilter> bloom_filter;
+};
+
 struct FieldID;
 struct ChildFieldIDs {
 	ChildFieldIDs();
@@ -62,12 +78,18 @@ struct FieldID {
 };
 
 class ParquetWriter {
+public:
+	//! We limit the uncompressed page size to 100MB
+	//! The max size in Parquet is 2GB, but we choose a more conservative limit
+	static constexpr const idx_t MAX_UNCOMPRESSED_PAGE_SIZE = 100000000;
+
 public:
 	ParquetWriter(ClientContext &context, FileSystem &fs, string file_name, vector<LogicalType> types,
 	              vector<string> names, duckdb_parquet::format::CompressionCodec::type codec, ChildFieldIDs field_ids,
 	              const vector<pair<string, string>> &kv_metadata,
 	              shared_ptr<ParquetEncryptionConfig> encryption_config, double dictionary_compression_ratio_threshold,
-	              optional_idx compression_level, bool debug_use_openssl);
+	              optional_idx compression_level, bool debug_use_openssl, idx_t page_size_bytes,
+	              const vector<string> &bloom_filter_columns, double bloom_filter_false_positive_ratio);
 
 public:
 	void PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result);
@@ -103,11 +125,25 @@ public:
 	optional_idx CompressionLevel() const {
 		return compression_level;
 	}
+	idx_t PageSizeBytes() const {
+		return page_size_bytes;
+	}
+	double BloomFilterFalsePositiveRatio() const {
+		return bloom_filter_false_positive_ratio;
+	}
 	idx_t NumberOfRowGroups() {
 		lock_guard<mutex> glock(lock);
 		return file_meta_data.row_groups.size();
 	}
 
+	//! Register the page index of a column chunk of the row group that is currently being flushed
+	void RegisterPageIndex(idx_t column_idx, unique_ptr<duckdb_parquet::format::ColumnIndex> column_index,
+	                       unique_ptr<duckdb_parquet::format::OffsetIndex> offset_index);
+	//! Whether or not a Bloom filter should be written for the (top-level) column with the given schema path
+	bool WriteBloomFilter(const vector<string> &schema_path) const;
+	//! Register the Bloom filter of a column chunk of the row group that is currently being flushed
+	void RegisterBloomFilter(idx_t column_idx, unique_ptr<ParquetBloomFilter> bloom_filter);
+
 	uint32_t Write(const duckdb_apache::thrift::TBase &object);
 	uint32_t WriteData(const const_data_ptr_t buffer, const uint32_t buffer_size);
 
@@ -116,6 +152,10 @@ public:
 	static bool TryGetParquetType(const LogicalType &duckdb_type,
 	                              optional_ptr<duckdb_parquet::format::Type::type> type = nullptr);
 
+private:
+	void WritePageIndexes();
+	void WriteBloomFilters(duckdb_parquet::format::RowGroup &row_group);
+
 private:
 	string file_name;
 	vector<LogicalType> sql_types;
@@ -126,6 +166,9 @@ private:
 	double dictionary_compression_ratio_threshold;
 	optional_idx compression_level;
 	bool debug_use_openssl;
+	idx_t page_size_bytes;
+	case_insensitive_set_t bloom_filter_columns;
+	double bloom_filter_false_positive_ratio;
 	shared_ptr<EncryptionUtil> encryption_util;
 
 	unique_ptr<BufferedFileWriter> writer;
@@ -134,6 +177,8 @@ private:
 	std::mutex lock;
 
 	vector<unique_ptr<ColumnWriter>> column_writers;
+	vector<ColumnChunkPageIndex> page_indexes;
+	vector<ColumnChunkBloomFilter> bloom_filters;
 
 	unique_ptr<GeoParquetFileMetadata> geoparquet_data;
 };
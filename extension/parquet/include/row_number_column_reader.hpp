@@ -47,6 +47,8 @@ public:
 	}
 	void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) override {
 	}
+	void RegisterReadAhead(ThriftFileTransport &transport, const vector<ColumnChunk> &columns) override {
+	}
 
 private:
 	idx_t row_group_offset;
@@ -7,6 +7,7 @@
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/allocator.hpp"
+#include "duckdb/parallel/task_executor.hpp"
 #endif
 
 namespace duckdb {
@@ -31,27 +32,62 @@ struct ReadHead {
 	}
 };
 
-// Comparator for ReadHeads that are either overlapping, adjacent, or within ALLOW_GAP bytes from each other
+// Comparator for ReadHeads that are either overlapping, adjacent, or within allow_gap bytes from each other
 struct ReadHeadComparator {
 	static constexpr uint64_t ALLOW_GAP = 1 << 14; // 16 KiB
+	// Row groups are read ahead in a single request per merged range while another row group is being decoded, so the
+	// columns are merged more aggressively: a remote request costs a round trip (tens of ms), while 1MiB at 100MB/s
+	// takes 10ms to transfer
+	static constexpr uint64_t READ_AHEAD_ALLOW_GAP = 1 << 20; // 1 MiB
+
+	explicit ReadHeadComparator(uint64_t allow_gap = ALLOW_GAP) : allow_gap(allow_gap) {
+	}
+
+	uint64_t allow_gap;
+
 	bool operator()(const ReadHead *a, const ReadHead *b) const {
 		auto a_start = a->location;
 		auto a_end = a->location + a->size;
 		auto b_start = b->location;
 
-		if (a_end <= NumericLimits<idx_t>::Maximum() - ALLOW_GAP) {
-			a_end += ALLOW_GAP;
+		if (a_end <= NumericLimits<idx_t>::Maximum() - allow_gap) {
+			a_end += allow_gap;
 		}
 
 		return a_start < b_start && a_end < b_start;
 	}
 };
 
+// Task that reads a single read head in the background (see ReadAheadBuffer::PrefetchAsync)
+class ReadHeadPrefetchTask : public BaseExecutorTask {
+public:
+	ReadHeadPrefetchTask(TaskExecutor &executor, FileHandle &handle, ReadHead &read_head, const atomic<bool> &cancelled)
+	    : BaseExecutorTask(executor), handle(handle), read_head(read_head), cancelled(cancelled) {
+	}
+
+	void ExecuteTask() override {
+		if (cancelled) {
+			return;
+		}
+		handle.Read(read_head.data.get(), read_head.size, read_head.location);
+		read_head.data_isset = true;
+	}
+
+private:
+	FileHandle &handle;
+	ReadHead &read_head;
+	const atomic<bool> &cancelled;
+};
+
 // Two-step read ahead buffer
 // 1: register all ranges that will be read, merging ranges that are consecutive
 // 2: prefetch all registered ranges
 struct ReadAheadBuffer {
-	ReadAheadBuffer(Allocator &allocator, FileHandle &handle) : allocator(allocator), handle(handle) {
+	ReadAheadBuffer(Allocator &allocator, FileHandle &handle, uint64_t allow_gap = ReadHeadComparator::ALLOW_GAP)
+	    : merge_set(ReadHeadComparator(allow_gap)), allocator(allocator), handle(handle) {
+	}
+	~ReadAheadBuffer() {
+		CancelPrefetch();
 	}
 
 	// The list of read heads
@@ -64,6 +100,11 @@ struct ReadAheadBuffer {
 
 	idx_t total_size = 0;
 
+	// Executor of the tasks reading the read heads ahead of the decoder (see PrefetchAsync)
+	unique_ptr<TaskExecutor> prefetch_executor;
+	// Set to skip the background reads that did not start yet
+	atomic<bool> prefetch_cancelled {false};
+
 	// Add a read head to the prefetching list
 	void AddReadHead(idx_t pos, uint64_t len, bool merge_buffers = true) {
 		// Attempt to merge with existing
@@ -74,6 +115,7 @@ struct ReadAheadBuffer {
 				auto existing_head = *lookup_set;
 				auto new_start = MinValue<idx_t>(existing_head->location, new_read_head.location);
 				auto new_length = MaxValue<idx_t>(existing_head->GetEnd(), new_read_head.GetEnd()) - new_start;
+				total_size += new_length - existing_head->size;
 				existing_head->location = new_start;
 				existing_head->size = new_length;
 				return;
@@ -116,6 +158,50 @@ struct ReadAheadBuffer {
 			read_head.data_isset = true;
 		}
 	}
+
+	// Prefetch all read heads in tasks of the task scheduler, the read heads can only be accessed after WaitForPrefetch
+	void PrefetchAsync(TaskScheduler &scheduler) {
+		D_ASSERT(!prefetch_executor);
+		for (auto &read_head : read_heads) {
+			if (read_head.GetEnd() > handle.GetFileSize()) {
+				throw std::runtime_error("Prefetch registered requested for bytes outside file");
+			}
+			read_head.Allocate(allocator);
+		}
+		prefetch_cancelled = false;
+		prefetch_executor = make_uniq<TaskExecutor>(scheduler);
+		for (auto &read_head : read_heads) {
+			prefetch_executor->ScheduleTask(
+			    make_uniq<ReadHeadPrefetchTask>(*prefetch_executor, handle, read_head, prefetch_cancelled));
+		}
+	}
+
+	// Wait for a background prefetch (if any) to finish - reads that were not picked up by another thread yet are
+	// executed by the calling thread. Throws if any of the background reads failed.
+	void WaitForPrefetch() {
+		if (!prefetch_executor) {
+			return;
+		}
+		auto executor = std::move(prefetch_executor);
+		executor->WorkOnTasks();
+	}
+
+	// Skip the background reads that did not start yet and wait for the others to finish
+	void CancelPrefetch() {
+		prefetch_cancelled = true;
+		try {
+			WaitForPrefetch();
+		} catch (std::exception &ex) {
+			// the data that was read ahead is not used, so neither are the errors of reading it
+		}
+	}
+
+	void Clear() {
+		CancelPrefetch();
+		read_heads.clear();
+		merge_set.clear();
+		total_size = 0;
+	}
 };
 
 class ThriftFileTransport : public duckdb_apache::thrift::transport::TVirtualTransport<ThriftFileTransport> {
@@ -123,7 +209,7 @@ public:
 	static constexpr uint64_t PREFETCH_FALLBACK_BUFFERSIZE = 1000000;
 
 	ThriftFileTransport(Allocator &allocator, FileHandle &handle_p, bool prefetch_mode_p)
-	    : handle(handle_p), location(0), allocator(allocator), ra_buffer(ReadAheadBuffer(allocator, handle_p)),
+	    : handle(handle_p), location(0), allocator(allocator), ra_buffer(allocator, handle_p),
 	      prefetch_mode(prefetch_mode_p) {
 	}
 
@@ -175,8 +261,57 @@ public:
 	}
 
 	void ClearPrefetch() {
-		ra_buffer.read_heads.clear();
-		ra_buffer.merge_set.clear();
+		ra_buffer.Clear();
+	}
+
+	// Start registering the ranges of a later row group to read ahead in the background
+	void BeginReadAhead() {
+		read_ahead_buffers.emplace_back(allocator, handle, ReadHeadComparator::READ_AHEAD_ALLOW_GAP);
+	}
+
+	// Register a range for the read ahead started by BeginReadAhead
+	void RegisterReadAhead(idx_t pos, uint64_t len) {
+		D_ASSERT(!read_ahead_buffers.empty());
+		read_ahead_buffers.back().AddReadHead(pos, len, true);
+	}
+
+	// Total size of the ranges registered for the read ahead started by BeginReadAhead
+	idx_t ReadAheadSize() const {
+		D_ASSERT(!read_ahead_buffers.empty());
+		return read_ahead_buffers.back().total_size;
+	}
+
+	// Start reading the ranges registered since BeginReadAhead in tasks of the scheduler
+	void ReadAheadRegistered(TaskScheduler &scheduler) {
+		D_ASSERT(!read_ahead_buffers.empty());
+		read_ahead_buffers.back().merge_set.clear();
+		read_ahead_buffers.back().PrefetchAsync(scheduler);
+	}
+
+	// Drop the read ahead started by BeginReadAhead
+	void CancelReadAhead() {
+		D_ASSERT(!read_ahead_buffers.empty());
+		read_ahead_buffers.pop_back();
+	}
+
+	// Drop the oldest read ahead (its row group is not scanned after all)
+	void DropReadAhead() {
+		D_ASSERT(!read_ahead_buffers.empty());
+		read_ahead_buffers.pop_front();
+	}
+
+	// Move the oldest read ahead into the prefetch buffer, waiting for its background reads to finish
+	void UseReadAhead() {
+		D_ASSERT(!read_ahead_buffers.empty());
+		auto &read_ahead = read_ahead_buffers.front();
+		read_ahead.WaitForPrefetch();
+		ra_buffer.read_heads.splice(ra_buffer.read_heads.end(), read_ahead.read_heads);
+		ra_buffer.total_size += read_ahead.total_size;
+		read_ahead_buffers.pop_front();
+	}
+
+	void ClearReadAhead() {
+		read_ahead_buffers.clear();
 	}
 
 	void SetLocation(idx_t location_p) {
@@ -198,6 +333,8 @@ private:
 
 	// Multi-buffer prefetch
 	ReadAheadBuffer ra_buffer;
+	// Ranges of later row groups that are being read in the background, in the order they will be used
+	std::list<ReadAheadBuffer> read_ahead_buffers;
 
 	// Whether the prefetch mode is enabled. In this mode the DirectIO flag of the handle will be set and the parquet
 	// reader will manage the read buffering.
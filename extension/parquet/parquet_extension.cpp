@@ -93,6 +93,10 @@ struct ParquetReadLocalState : public LocalTableFunctionState {
 	idx_t file_index;
 	//! The DataChunk containing all read columns (even columns that are immediately removed)
 	DataChunk all_columns;
+	//! The row group of the current reader this thread reserved to scan next, while reading it ahead in the background
+	optional_idx reserved_row_group;
+	//! The batch index of the reserved row group
+	idx_t reserved_batch_index;
 };
 
 enum class ParquetFileState : uint8_t { UNOPENED, OPENING, OPEN, CLOSED };
@@ -201,6 +205,14 @@ struct ParquetWriteBindData : public TableFunctionData {
 	ChildFieldIDs field_ids;
 	//! The compression level, higher value is more
 	optional_idx compression_level;
+
+	//! The (estimated) maximum uncompressed size of a data page - smaller pages allow more pages to be skipped
+	idx_t page_size_bytes = ParquetWriter::MAX_UNCOMPRESSED_PAGE_SIZE;
+
+	//! The (top-level) columns for which we write Bloom filters
+	vector<string> bloom_filter_columns;
+	//! The target false positive ratio of the Bloom filters
+	double bloom_filter_false_positive_ratio = 0.01;
 };
 
 struct ParquetWriteGlobalState : public GlobalFunctionData {
@@ -889,12 +901,37 @@ public:
 		return true;
 	}
 
+	//! Reserve the next row group of the file this thread is scanning, if the reader can read it ahead in the
+	//! background while the current row group is being decoded. Parallel lock should be locked when calling.
+	static void ReserveNextRowGroup(ClientContext &context, ParquetReadLocalState &scan_data,
+	                                ParquetReadGlobalState &parallel_state) {
+		if (parallel_state.file_index != scan_data.file_index ||
+		    parallel_state.row_group_index >= scan_data.reader->NumRowGroups()) {
+			return;
+		}
+		if (!scan_data.reader->ReadAheadGroup(context, scan_data.scan_state, parallel_state.row_group_index)) {
+			return;
+		}
+		scan_data.reserved_row_group = parallel_state.row_group_index++;
+		scan_data.reserved_batch_index = parallel_state.batch_index++;
+	}
+
 	// This function looks for the next available row group. If not available, it will open files from bind_data.files
 	// until there is a row group available for scanning or the files runs out
 	static bool ParquetParallelStateNext(ClientContext &context, const ParquetReadBindData &bind_data,
 	                                     ParquetReadLocalState &scan_data, ParquetReadGlobalState &parallel_state) {
 		unique_lock<mutex> parallel_lock(parallel_state.lock);
 
+		if (scan_data.reserved_row_group.IsValid()) {
+			// scan the row group this thread reserved (and has been reading ahead) when it got its previous row group
+			vector<idx_t> group_indexes {scan_data.reserved_row_group.GetIndex()};
+			scan_data.reserved_row_group = optional_idx();
+			scan_data.reader->InitializeScan(context, scan_data.scan_state, group_indexes);
+			scan_data.batch_index = scan_data.reserved_batch_index;
+			ReserveNextRowGroup(context, scan_data, parallel_state);
+			return true;
+		}
+
 		while (true) {
 			if (parallel_state.error_opening_file) {
 				return false;
@@ -914,6 +951,7 @@ public:
 					scan_data.batch_index = parallel_state.batch_index++;
 					scan_data.file_index = parallel_state.file_index;
 					parallel_state.row_group_index++;
+					ReserveNextRowGroup(context, scan_data, parallel_state);
 					return true;
 				} else {
 					// Close current file
@@ -1192,6 +1230,22 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 	auto bind_data = make_uniq<ParquetWriteBindData>();
 	for (auto &option : input.info.options) {
 		const auto loption = StringUtil::Lower(option.first);
+		if (loption == "bloom_filter_columns") {
+			// this option takes a list of columns, either as multiple arguments or as a single LIST
+			case_insensitive_set_t column_names(names.begin(), names.end());
+			for (auto &value : option.second) {
+				auto column_values = value.type().id() == LogicalTypeId::LIST ? ListValue::GetChildren(value)
+				                                                               : vector<Value> {value};
+				for (auto &column_value : column_values) {
+					auto column_name = column_value.ToString();
+					if (column_names.find(column_name) == column_names.end()) {
+						throw BinderException("Column \"%s\" in BLOOM_FILTER_COLUMNS does not exist", column_name);
+					}
+					bind_data->bloom_filter_columns.push_back(std::move(column_name));
+				}
+			}
+			continue;
+		}
 		if (option.second.size() != 1) {
 			// All parquet write options require exactly one argument
 			throw BinderException("%s requires exactly one argument", StringUtil::Upper(loption));
@@ -1206,6 +1260,18 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 				bind_data->row_group_size_bytes = option.second[0].GetValue<uint64_t>();
 			}
 			row_group_size_bytes_set = true;
+		} else if (loption == "page_size_bytes") {
+			auto roption = option.second[0];
+			if (roption.GetTypeMutable().id() == LogicalTypeId::VARCHAR) {
+				bind_data->page_size_bytes = DBConfig::ParseMemoryLimit(roption.ToString());
+			} else {
+				bind_data->page_size_bytes = option.second[0].GetValue<uint64_t>();
+			}
+			if (bind_data->page_size_bytes == 0 ||
+			    bind_data->page_size_bytes > ParquetWriter::MAX_UNCOMPRESSED_PAGE_SIZE) {
+				throw BinderException("PAGE_SIZE_BYTES must be between 1 and %llu bytes",
+				                      ParquetWriter::MAX_UNCOMPRESSED_PAGE_SIZE);
+			}
 		} else if (loption == "row_groups_per_file") {
 			bind_data->row_groups_per_file = option.second[0].GetValue<uint64_t>();
 		} else if (loption == "compression" || loption == "codec") {
@@ -1274,6 +1340,12 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 				                      "dictionary compression");
 			}
 			bind_data->dictionary_compression_ratio_threshold = val;
+		} else if (loption == "bloom_filter_false_positive_ratio") {
+			auto val = option.second[0].GetValue<double>();
+			if (!(val > 0 && val < 1)) {
+				throw BinderException("BLOOM_FILTER_FALSE_POSITIVE_RATIO must be between 0 and 1 (exclusive)");
+			}
+			bind_data->bloom_filter_false_positive_ratio = val;
 		} else if (loption == "debug_use_openssl") {
 			auto val = StringUtil::Lower(option.second[0].GetValue<std::string>());
 			if (val == "false") {
@@ -1314,7 +1386,9 @@ unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext &conte
 	    make_uniq<ParquetWriter>(context, fs, file_path, parquet_bind.sql_types, parquet_bind.column_names,
 	                             parquet_bind.codec, parquet_bind.field_ids.Copy(), parquet_bind.kv_metadata,
 	                             parquet_bind.encryption_config, parquet_bind.dictionary_compression_ratio_threshold,
-	                             parquet_bind.compression_level, parquet_bind.debug_use_openssl);
+	                             parquet_bind.compression_level, parquet_bind.debug_use_openssl,
+	                             parquet_bind.page_size_bytes, parquet_bind.bloom_filter_columns,
+	                             parquet_bind.bloom_filter_false_positive_ratio);
 	return std::move(global_state);
 }
 
@@ -1438,6 +1512,11 @@ static void ParquetCopySerialize(Serializer &serializer, const FunctionData &bin
 	serializer.WritePropertyWithDefault<optional_idx>(109, "compression_level", bind_data.compression_level);
 	serializer.WriteProperty(110, "row_groups_per_file", bind_data.row_groups_per_file);
 	serializer.WriteProperty(111, "debug_use_openssl", bind_data.debug_use_openssl);
+	serializer.WritePropertyWithDefault<idx_t>(112, "page_size_bytes", bind_data.page_size_bytes,
+	                                           idx_t(ParquetWriter::MAX_UNCOMPRESSED_PAGE_SIZE));
+	serializer.WritePropertyWithDefault<vector<string>>(113, "bloom_filter_columns", bind_data.bloom_filter_columns);
+	serializer.WritePropertyWithDefault<double>(114, "bloom_filter_false_positive_ratio",
+	                                            bind_data.bloom_filter_false_positive_ratio, 0.01);
 }
 
 static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserializer, CopyFunction &function) {
@@ -1457,6 +1536,11 @@ static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserialize
 	data->row_groups_per_file =
 	    deserializer.ReadPropertyWithExplicitDefault<optional_idx>(110, "row_groups_per_file", optional_idx::Invalid());
 	data->debug_use_openssl = deserializer.ReadPropertyWithExplicitDefault<bool>(111, "debug_use_openssl", true);
+	data->page_size_bytes = deserializer.ReadPropertyWithExplicitDefault<idx_t>(
+	    112, "page_size_bytes", idx_t(ParquetWriter::MAX_UNCOMPRESSED_PAGE_SIZE));
+	deserializer.ReadPropertyWithDefault<vector<string>>(113, "bloom_filter_columns", data->bloom_filter_columns);
+	data->bloom_filter_false_positive_ratio =
+	    deserializer.ReadPropertyWithExplicitDefault<double>(114, "bloom_filter_false_positive_ratio", 0.01);
 	return std::move(data);
 }
 // LCOV_EXCL_STOP
@@ -26,8 +26,12 @@
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/hive_partitioning.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/object_cache.hpp"
@@ -40,11 +44,14 @@
 
 namespace duckdb {
 
+using duckdb_parquet::format::BloomFilterHeader;
 using duckdb_parquet::format::ColumnChunk;
+using duckdb_parquet::format::ColumnIndex;
 using duckdb_parquet::format::ConvertedType;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::FileCryptoMetaData;
 using duckdb_parquet::format::FileMetaData;
+using duckdb_parquet::format::OffsetIndex;
 using ParquetRowGroup = duckdb_parquet::format::RowGroup;
 using duckdb_parquet::format::SchemaElement;
 using duckdb_parquet::format::Statistics;
@@ -685,6 +692,46 @@ uint64_t ParquetReader::GetGroupSpan(ParquetReaderScanState &state) {
 	return max_offset - min_offset;
 }
 
+bool ParquetReader::ReadAheadGroup(ClientContext &context, ParquetReaderScanState &state, idx_t group_idx) {
+	if (!state.prefetch_mode ||
+	    state.read_ahead_groups.size() >= ParquetReaderPrefetchConfig::MAXIMUM_READ_AHEAD_GROUPS) {
+		return false;
+	}
+	auto &columns = GetFileMetadata()->row_groups[group_idx].columns;
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+	if (reader_data.filters && GroupStatisticsExclude(root_reader, group_idx)) {
+		// the row group is skipped by the scan - there is nothing to read ahead
+		return false;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	trans.BeginReadAhead();
+	for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+		if (reader_data.filters && !ColumnHasFilter(col_idx)) {
+			// the other columns are fetched lazily: they are not read at all if no rows pass the filters
+			continue;
+		}
+		root_reader.GetChildReader(reader_data.column_ids[col_idx])->RegisterReadAhead(trans, columns);
+	}
+	// bound the memory that is read ahead
+	auto read_ahead_size = trans.ReadAheadSize();
+	if (read_ahead_size == 0 || read_ahead_size > ParquetReaderPrefetchConfig::MAXIMUM_READ_AHEAD_SIZE) {
+		trans.CancelReadAhead();
+		return false;
+	}
+	trans.ReadAheadRegistered(TaskScheduler::GetScheduler(context));
+	state.read_ahead_groups.push_back(group_idx);
+	return true;
+}
+
+bool ParquetReader::ColumnHasFilter(idx_t col_idx) {
+	if (!reader_data.filters) {
+		return false;
+	}
+	// filters contain output chunk index, not file col idx!
+	auto &filters = reader_data.filters->filters;
+	return filters.find(reader_data.column_mapping[col_idx]) != filters.end();
+}
+
 idx_t ParquetReader::GetGroupOffset(ParquetReaderScanState &state) {
 	auto &group = GetGroup(state);
 	idx_t min_offset = NumericLimits<idx_t>::Maximum();
@@ -711,11 +758,68 @@ static FilterPropagateResult CheckParquetStringFilter(BaseStatistics &stats, con
 		return StringStats::CheckZonemap(const_data_ptr_cast(min_value.c_str()), min_value.size(),
 		                                 const_data_ptr_cast(max_value.c_str()), max_value.size(),
 		                                 constant_filter.comparison_type, StringValue::Get(constant_filter.constant));
+	} else if (filter.filter_type == TableFilterType::IN_FILTER) {
+		auto &in_filter = filter.Cast<InFilter>();
+		auto &min_value = pq_col_stats.min_value;
+		auto &max_value = pq_col_stats.max_value;
+		for (auto &value : in_filter.values) {
+			auto prune_result = StringStats::CheckZonemap(
+			    const_data_ptr_cast(min_value.c_str()), min_value.size(), const_data_ptr_cast(max_value.c_str()),
+			    max_value.size(), ExpressionType::COMPARE_EQUAL, StringValue::Get(value));
+			if (prune_result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+			}
+		}
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
 	} else {
 		return filter.CheckStatistics(stats);
 	}
 }
 
+static FilterPropagateResult CheckColumnFilter(ColumnReader &column_reader, BaseStatistics &stats,
+                                               const vector<ColumnChunk> &columns, TableFilter &filter) {
+	if (column_reader.Type().id() != LogicalTypeId::VARCHAR ||
+	    !columns[column_reader.FileIdx()].meta_data.statistics.__isset.min_value ||
+	    !columns[column_reader.FileIdx()].meta_data.statistics.__isset.max_value) {
+		return filter.CheckStatistics(stats);
+	}
+	// our StringStats only store the first 8 bytes of strings (even if Parquet has longer string stats)
+	// however, when reading remote Parquet files, skipping row groups is really important
+	// here, we implement a special case to check the full length for string filters
+	auto &pq_col_stats = columns[column_reader.FileIdx()].meta_data.statistics;
+	if (filter.filter_type == TableFilterType::CONJUNCTION_AND) {
+		const auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		auto and_result = FilterPropagateResult::FILTER_ALWAYS_TRUE;
+		for (auto &child_filter : and_filter.child_filters) {
+			auto child_prune_result = CheckParquetStringFilter(stats, pq_col_stats, *child_filter);
+			if (child_prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+			} else if (child_prune_result != and_result) {
+				and_result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
+			}
+		}
+		return and_result;
+	}
+	return CheckParquetStringFilter(stats, pq_col_stats, filter);
+}
+
+bool ParquetReader::GroupStatisticsExclude(StructColumnReader &root_reader, idx_t group_idx) {
+	auto &columns = GetFileMetadata()->row_groups[group_idx].columns;
+	for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+		auto filter_entry = reader_data.filters->filters.find(reader_data.column_mapping[col_idx]);
+		if (filter_entry == reader_data.filters->filters.end()) {
+			continue;
+		}
+		auto column_reader = root_reader.GetChildReader(reader_data.column_ids[col_idx]);
+		auto stats = column_reader->Stats(group_idx, columns);
+		if (stats && CheckColumnFilter(*column_reader, *stats, columns, *filter_entry->second) ==
+		                 FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			return true;
+		}
+	}
+	return false;
+}
+
 void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t col_idx) {
 	auto &group = GetGroup(state);
 	auto column_id = reader_data.column_ids[col_idx];
@@ -728,42 +832,11 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 		auto global_id = reader_data.column_mapping[col_idx];
 		auto filter_entry = reader_data.filters->filters.find(global_id);
 		if (stats && filter_entry != reader_data.filters->filters.end()) {
-			bool skip_chunk = false;
 			auto &filter = *filter_entry->second;
-
-			FilterPropagateResult prune_result;
-			if (column_reader->Type().id() == LogicalTypeId::VARCHAR &&
-			    group.columns[column_reader->FileIdx()].meta_data.statistics.__isset.min_value &&
-			    group.columns[column_reader->FileIdx()].meta_data.statistics.__isset.max_value) {
-				// our StringStats only store the first 8 bytes of strings (even if Parquet has longer string stats)
-				// however, when reading remote Parquet files, skipping row groups is really important
-				// here, we implement a special case to check the full length for string filters
-				if (filter.filter_type == TableFilterType::CONJUNCTION_AND) {
-					const auto &and_filter = filter.Cast<ConjunctionAndFilter>();
-					auto and_result = FilterPropagateResult::FILTER_ALWAYS_TRUE;
-					for (auto &child_filter : and_filter.child_filters) {
-						auto child_prune_result = CheckParquetStringFilter(
-						    *stats, group.columns[column_reader->FileIdx()].meta_data.statistics, *child_filter);
-						if (child_prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
-							and_result = FilterPropagateResult::FILTER_ALWAYS_FALSE;
-							break;
-						} else if (child_prune_result != and_result) {
-							and_result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
-						}
-					}
-					prune_result = and_result;
-				} else {
-					prune_result = CheckParquetStringFilter(
-					    *stats, group.columns[column_reader->FileIdx()].meta_data.statistics, filter);
-				}
-			} else {
-				prune_result = filter.CheckStatistics(*stats);
-			}
-
-			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
-				skip_chunk = true;
-			}
-			if (skip_chunk) {
+			auto prune_result = CheckColumnFilter(*column_reader, *stats, group.columns, filter);
+			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE ||
+			    (prune_result == FilterPropagateResult::NO_PRUNING_POSSIBLE &&
+			     BloomFilterExcludes(state, *column_reader, filter))) {
 				// this effectively will skip this chunk
 				state.group_offset = group.num_rows;
 				return;
@@ -775,6 +848,216 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 	                                  *state.thrift_file_proto);
 }
 
+bool ParquetReader::BloomFilterExcludes(ParquetReaderScanState &state, ColumnReader &column_reader,
+                                        const TableFilter &filter) {
+	auto &group = GetGroup(state);
+	// encrypted files encrypt the Bloom filters with separate keys - we do not support reading those
+	if (parquet_options.encryption_config || column_reader.Type().IsNested() || column_reader.MaxRepeat() > 0 ||
+	    column_reader.FileIdx() >= group.columns.size() || !ParquetStatisticsUtils::BloomFilterSupported(filter)) {
+		return false;
+	}
+	auto &column_meta_data = group.columns[column_reader.FileIdx()].meta_data;
+	if (!column_meta_data.__isset.bloom_filter_offset) {
+		return false;
+	}
+
+	// the Bloom filter is read through its own transport so we do not interfere with the prefetched column data
+	auto file_proto = CreateThriftFileProtocol(allocator, *state.file_handle, true);
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*file_proto->getTransport());
+	auto bloom_filter_offset = NumericCast<idx_t>(column_meta_data.bloom_filter_offset);
+	if (column_meta_data.__isset.bloom_filter_length) {
+		trans.Prefetch(bloom_filter_offset, NumericCast<idx_t>(column_meta_data.bloom_filter_length));
+	}
+	trans.SetLocation(bloom_filter_offset);
+
+	BloomFilterHeader header;
+	header.read(file_proto.get());
+	if (!header.algorithm.__isset.BLOCK || !header.hash.__isset.XXHASH || !header.compression.__isset.UNCOMPRESSED ||
+	    header.numBytes <= 0 || idx_t(header.numBytes) > ParquetBloomFilter::MAX_BYTES ||
+	    header.numBytes % ParquetBloomFilter::BYTES_PER_BLOCK != 0) {
+		// unsupported (or malformed) Bloom filter - ignore it
+		return false;
+	}
+	ParquetBloomFilter bloom_filter(NumericCast<idx_t>(header.numBytes));
+	trans.read(bloom_filter.GetData(), NumericCast<uint32_t>(bloom_filter.SizeInBytes()));
+	return ParquetStatisticsUtils::BloomFilterExcludes(column_reader, filter, bloom_filter);
+}
+
+static bool HasOffsetIndex(ColumnReader &column_reader, const ParquetRowGroup &group) {
+	// page locations refer to row indexes, so we can only use them for (non-nested) columns without repeats
+	if (column_reader.Type().IsNested() || column_reader.MaxRepeat() > 0 ||
+	    column_reader.FileIdx() >= group.columns.size()) {
+		return false;
+	}
+	auto &column_chunk = group.columns[column_reader.FileIdx()];
+	return column_chunk.__isset.offset_index_offset && column_chunk.__isset.offset_index_length;
+}
+
+static bool HasColumnIndex(ColumnReader &column_reader, const ParquetRowGroup &group) {
+	if (!HasOffsetIndex(column_reader, group)) {
+		return false;
+	}
+	auto &column_chunk = group.columns[column_reader.FileIdx()];
+	return column_chunk.__isset.column_index_offset && column_chunk.__isset.column_index_length;
+}
+
+// intersect two sorted lists of disjoint row ranges
+static vector<pair<idx_t, idx_t>> IntersectRowRanges(const vector<pair<idx_t, idx_t>> &left,
+                                                     const vector<pair<idx_t, idx_t>> &right) {
+	vector<pair<idx_t, idx_t>> result;
+	idx_t left_idx = 0;
+	idx_t right_idx = 0;
+	while (left_idx < left.size() && right_idx < right.size()) {
+		auto start = MaxValue<idx_t>(left[left_idx].first, right[right_idx].first);
+		auto end = MinValue<idx_t>(left[left_idx].second, right[right_idx].second);
+		if (start < end) {
+			result.emplace_back(start, end);
+		}
+		if (left[left_idx].second < right[right_idx].second) {
+			left_idx++;
+		} else {
+			right_idx++;
+		}
+	}
+	return result;
+}
+
+void ParquetReader::PreparePageIndex(ParquetReaderScanState &state) {
+	state.row_ranges.clear();
+	state.current_row_range = 0;
+
+	auto &group = GetGroup(state);
+	auto group_rows = NumericCast<idx_t>(group.num_rows);
+	// encrypted files encrypt the page index with separate keys - we do not support reading those
+	if (!reader_data.filters || parquet_options.encryption_config || state.group_offset == group_rows) {
+		return;
+	}
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+
+	// find the filtered columns that have a column index
+	vector<pair<ColumnReader *, TableFilter *>> index_filters;
+	for (auto &filter_col : reader_data.filters->filters) {
+		auto &filter_entry = reader_data.filter_map[filter_col.first];
+		if (filter_entry.is_constant) {
+			continue;
+		}
+		auto column_reader = root_reader.GetChildReader(reader_data.column_ids[filter_entry.index]);
+		if (HasColumnIndex(*column_reader, group)) {
+			index_filters.emplace_back(column_reader, filter_col.second.get());
+		}
+	}
+	if (index_filters.empty()) {
+		return;
+	}
+
+	// the page index is read through its own transport so we do not interfere with the prefetched column data
+	auto file_proto = CreateThriftFileProtocol(allocator, *state.file_handle, false);
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*file_proto->getTransport());
+	for (auto &index_filter : index_filters) {
+		auto &column_chunk = group.columns[index_filter.first->FileIdx()];
+		trans.RegisterPrefetch(NumericCast<idx_t>(column_chunk.column_index_offset),
+		                       NumericCast<idx_t>(column_chunk.column_index_length));
+		trans.RegisterPrefetch(NumericCast<idx_t>(column_chunk.offset_index_offset),
+		                       NumericCast<idx_t>(column_chunk.offset_index_length));
+	}
+	trans.FinalizeRegistration();
+	trans.PrefetchRegistered();
+
+	auto row_group_idx = state.group_idx_list[state.current_group];
+	unordered_map<idx_t, OffsetIndex> offset_indexes;
+	vector<pair<idx_t, idx_t>> row_ranges {make_pair(idx_t(0), group_rows)};
+	for (auto &index_filter : index_filters) {
+		auto &column_reader = *index_filter.first;
+		auto file_idx = column_reader.FileIdx();
+		auto &column_chunk = group.columns[file_idx];
+
+		ColumnIndex column_index;
+		trans.SetLocation(NumericCast<idx_t>(column_chunk.column_index_offset));
+		Read(column_index, *file_proto);
+		auto &offset_index = offset_indexes[file_idx];
+		trans.SetLocation(NumericCast<idx_t>(column_chunk.offset_index_offset));
+		Read(offset_index, *file_proto);
+
+		auto &page_locations = offset_index.page_locations;
+		if (column_index.null_pages.size() != page_locations.size() ||
+		    column_index.min_values.size() != page_locations.size() ||
+		    column_index.max_values.size() != page_locations.size()) {
+			// malformed page index - ignore it
+			continue;
+		}
+
+		// evaluate the filter against the statistics of every page
+		auto columns = group.columns;
+		columns[file_idx].meta_data.__isset.statistics = true;
+		auto &page_stats = columns[file_idx].meta_data.statistics;
+		vector<pair<idx_t, idx_t>> column_row_ranges;
+		for (idx_t page_idx = 0; page_idx < page_locations.size(); page_idx++) {
+			auto page_start = NumericCast<idx_t>(page_locations[page_idx].first_row_index);
+			auto page_end = page_idx + 1 < page_locations.size()
+			                    ? NumericCast<idx_t>(page_locations[page_idx + 1].first_row_index)
+			                    : group_rows;
+			if (!column_index.null_pages[page_idx]) {
+				page_stats = Statistics();
+				page_stats.__set_min_value(column_index.min_values[page_idx]);
+				page_stats.__set_max_value(column_index.max_values[page_idx]);
+				if (column_index.__isset.null_counts && page_idx < column_index.null_counts.size()) {
+					page_stats.__set_null_count(column_index.null_counts[page_idx]);
+				}
+				auto stats = column_reader.Stats(row_group_idx, columns);
+				if (stats && CheckColumnFilter(column_reader, *stats, columns, *index_filter.second) ==
+				                 FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+					continue;
+				}
+			}
+			if (!column_row_ranges.empty() && column_row_ranges.back().second == page_start) {
+				column_row_ranges.back().second = page_end;
+			} else {
+				column_row_ranges.emplace_back(page_start, page_end);
+			}
+		}
+		row_ranges = IntersectRowRanges(row_ranges, column_row_ranges);
+	}
+
+	if (row_ranges.empty()) {
+		// no page can pass the filters - skip the entire group
+		state.group_offset = group_rows;
+		return;
+	}
+	if (row_ranges.size() == 1 && row_ranges[0].first == 0 && row_ranges[0].second == group_rows) {
+		// no rows could be ruled out
+		return;
+	}
+	state.row_ranges = std::move(row_ranges);
+
+	// load the page locations of all columns we read, so they can jump over the pages that we skip
+	vector<ColumnReader *> page_index_readers;
+	for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+		auto column_reader = root_reader.GetChildReader(reader_data.column_ids[col_idx]);
+		if (!HasOffsetIndex(*column_reader, group)) {
+			continue;
+		}
+		page_index_readers.push_back(column_reader);
+		if (offset_indexes.find(column_reader->FileIdx()) == offset_indexes.end()) {
+			auto &column_chunk = group.columns[column_reader->FileIdx()];
+			trans.RegisterPrefetch(NumericCast<idx_t>(column_chunk.offset_index_offset),
+			                       NumericCast<idx_t>(column_chunk.offset_index_length));
+		}
+	}
+	trans.FinalizeRegistration();
+	trans.PrefetchRegistered();
+	for (auto column_reader : page_index_readers) {
+		auto file_idx = column_reader->FileIdx();
+		auto entry = offset_indexes.find(file_idx);
+		if (entry == offset_indexes.end()) {
+			auto &column_chunk = group.columns[file_idx];
+			trans.SetLocation(NumericCast<idx_t>(column_chunk.offset_index_offset));
+			Read(offset_indexes[file_idx], *file_proto);
+			entry = offset_indexes.find(file_idx);
+		}
+		column_reader->SetPageLocations(entry->second.page_locations);
+	}
+}
+
 idx_t ParquetReader::NumRows() {
 	return GetFileMetadata()->num_rows;
 }
@@ -791,11 +1074,15 @@ void ParquetReader::InitializeScan(ClientContext &context, ParquetReaderScanStat
 	state.group_idx_list = std::move(groups_to_read);
 	state.sel.Initialize(STANDARD_VECTOR_SIZE);
 	if (!state.file_handle || state.file_handle->path != file_handle->path) {
+		// the transport might still be reading ahead from the current file handle
+		state.thrift_file_proto.reset();
+		state.read_ahead_groups.clear();
 		auto flags = FileFlags::FILE_FLAGS_READ;
 
 		if (!file_handle->OnDiskFile() && file_handle->CanSeek()) {
 			state.prefetch_mode = true;
-			flags |= FileFlags::FILE_FLAGS_DIRECT_IO;
+			// row groups are read ahead in the background while the scan reads from the same handle
+			flags |= FileFlags::FILE_FLAGS_DIRECT_IO | FileFlags::FILE_FLAGS_PARALLEL_ACCESS;
 		} else {
 			state.prefetch_mode = false;
 		}
@@ -803,7 +1090,15 @@ void ParquetReader::InitializeScan(ClientContext &context, ParquetReaderScanStat
 		state.file_handle = fs.OpenFile(file_handle->path, flags);
 	}
 
-	state.thrift_file_proto = CreateThriftFileProtocol(allocator, *state.file_handle, state.prefetch_mode);
+	if (!state.thrift_file_proto) {
+		state.thrift_file_proto = CreateThriftFileProtocol(allocator, *state.file_handle, state.prefetch_mode);
+	} else if (!state.read_ahead_groups.empty() && state.read_ahead_groups[0] != state.group_idx_list[0]) {
+		// the transport of the file handle is kept so the groups that were read ahead can be used - unless we are not
+		// scanning them after all
+		auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+		trans.ClearReadAhead();
+		state.read_ahead_groups.clear();
+	}
 	state.root_reader = CreateReader(context);
 	state.define_buf.resize(allocator, STANDARD_VECTOR_SIZE);
 	state.repeat_buf.resize(allocator, STANDARD_VECTOR_SIZE);
@@ -851,6 +1146,47 @@ void FilterIsNotNull(Vector &v, parquet_filter_t &filter_mask, idx_t count) {
 	}
 }
 
+void FilterBloom(Vector &v, const BlockedBloomFilter &bloom_filter, parquet_filter_t &filter_mask, idx_t count) {
+	if (filter_mask.none() || count == 0) {
+		return;
+	}
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(v, hashes, count);
+
+	UnifiedVectorFormat vdata;
+	v.ToUnifiedFormat(count, vdata);
+	UnifiedVectorFormat hash_data;
+	hashes.ToUnifiedFormat(count, hash_data);
+	auto hash_ptr = UnifiedVectorFormat::GetData<hash_t>(hash_data);
+	for (idx_t i = 0; i < count; i++) {
+		if (filter_mask.test(i)) {
+			filter_mask.set(i, vdata.validity.RowIsValid(vdata.sel->get_index(i)) &&
+			                       bloom_filter.Lookup(hash_ptr[hash_data.sel->get_index(i)]));
+		}
+	}
+}
+
+void FilterIn(Vector &v, const InFilter &in_filter, parquet_filter_t &filter_mask, idx_t count) {
+	if (filter_mask.none() || count == 0) {
+		return;
+	}
+	SelectionVector sel(count);
+	idx_t approved_tuple_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (filter_mask.test(i)) {
+			sel.set_index(approved_tuple_count++, i);
+		}
+	}
+	UnifiedVectorFormat vdata;
+	v.ToUnifiedFormat(count, vdata);
+	in_filter.Filter(v, vdata, sel, approved_tuple_count);
+
+	filter_mask.reset();
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		filter_mask.set(sel.get_index(i));
+	}
+}
+
 template <class T, class OP>
 void TemplatedFilterOperation(Vector &v, T constant, parquet_filter_t &filter_mask, idx_t count) {
 	if (v.GetVectorType() == VectorType::CONSTANT_VECTOR) {
@@ -993,6 +1329,14 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 		auto &child = StructVector::GetEntries(v)[struct_filter.child_idx];
 		ApplyFilter(*child, *struct_filter.child_filter, filter_mask, count);
 	} break;
+	case TableFilterType::BLOOM_FILTER: {
+		auto &bloom_filter = filter.Cast<BloomFilter>();
+		FilterBloom(v, *bloom_filter.filter, filter_mask, count);
+	} break;
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		FilterIn(v, in_filter, filter_mask, count);
+	} break;
 	default:
 		D_ASSERT(0);
 		break;
@@ -1036,9 +1380,33 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 			auto &root_reader = state.root_reader->Cast<StructColumnReader>();
 			to_scan_compressed_bytes += root_reader.GetChildReader(file_col_idx)->TotalCompressedSize();
 		}
+		PreparePageIndex(state);
 
 		auto &group = GetGroup(state);
-		if (state.prefetch_mode && state.group_offset != (idx_t)group.num_rows) {
+		bool group_read_ahead =
+		    !state.read_ahead_groups.empty() && state.read_ahead_groups[0] == state.group_idx_list[state.current_group];
+		if (group_read_ahead) {
+			state.read_ahead_groups.erase(state.read_ahead_groups.begin());
+			if (state.group_offset == (idx_t)group.num_rows) {
+				// the group is skipped after all (e.g. because of its Bloom filter)
+				trans.DropReadAhead();
+				group_read_ahead = false;
+			}
+		}
+		if (group_read_ahead) {
+			// the columns of this group were already read in the background while decoding the previous group
+			trans.UseReadAhead();
+			if (reader_data.filters) {
+				// only the filtered columns were read ahead: fetch the other columns lazily
+				auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+				for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+					if (!ColumnHasFilter(col_idx)) {
+						root_reader.GetChildReader(reader_data.column_ids[col_idx])->RegisterPrefetch(trans, false);
+					}
+				}
+				trans.FinalizeRegistration();
+			}
+		} else if (state.prefetch_mode && state.group_offset != (idx_t)group.num_rows) {
 
 			uint64_t total_row_group_span = GetGroupSpan(state);
 
@@ -1069,11 +1437,7 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 					auto file_col_idx = reader_data.column_ids[col_idx];
 					auto &root_reader = state.root_reader->Cast<StructColumnReader>();
 
-					bool has_filter = false;
-					if (reader_data.filters) {
-						auto entry = reader_data.filters->filters.find(reader_data.column_mapping[col_idx]);
-						has_filter = entry != reader_data.filters->filters.end();
-					}
+					bool has_filter = ColumnHasFilter(col_idx);
 					root_reader.GetChildReader(file_col_idx)->RegisterPrefetch(trans, !(lazy_fetch && !has_filter));
 				}
 
@@ -1087,6 +1451,29 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		return true;
 	}
 
+	if (!state.row_ranges.empty()) {
+		// skip over the rows that the page index ruled out
+		auto &ranges = state.row_ranges;
+		while (state.current_row_range < ranges.size() &&
+		       ranges[state.current_row_range].second <= state.group_offset) {
+			state.current_row_range++;
+		}
+		auto group_rows = NumericCast<idx_t>(GetGroup(state).num_rows);
+		auto next_row = state.current_row_range < ranges.size() ? ranges[state.current_row_range].first : group_rows;
+		if (next_row > state.group_offset) {
+			if (next_row < group_rows) {
+				// the columns are re-initialized for the next group, so we only need to skip within the group
+				auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+				for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+					root_reader.GetChildReader(reader_data.column_ids[col_idx])->Skip(next_row - state.group_offset);
+				}
+			}
+			state.group_offset = next_row;
+			result.SetCardinality(0);
+			return true;
+		}
+	}
+
 	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, GetGroup(state).num_rows - state.group_offset);
 	result.SetCardinality(this_output_chunk_rows);
 
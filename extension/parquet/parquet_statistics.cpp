@@ -9,8 +9,14 @@
 #include "duckdb/common/types/blob.hpp"
 #include "duckdb/common/types/time.hpp"
 #include "duckdb/common/types/value.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/storage/statistics/struct_stats.hpp"
 #endif
+#include "zstd/common/xxhash.h"
+
+#include <cmath>
 
 namespace duckdb {
 
@@ -387,4 +393,189 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 	return row_group_stats;
 }
 
+
+//===--------------------------------------------------------------------===//
+// Bloom Filters
+//===--------------------------------------------------------------------===//
+// the salt values of the split block Bloom filter, as defined by the Parquet specification
+static constexpr const uint32_t BLOOM_FILTER_SALT[ParquetBloomFilter::WORDS_PER_BLOCK] = {
+    0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU, 0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+ParquetBloomFilter::ParquetBloomFilter(idx_t num_bytes) {
+	D_ASSERT(num_bytes > 0 && num_bytes % BYTES_PER_BLOCK == 0);
+	block_count = num_bytes / BYTES_PER_BLOCK;
+	blocks = make_unsafe_uniq_array<uint32_t>(block_count * WORDS_PER_BLOCK);
+}
+
+static idx_t BloomFilterSize(idx_t num_distinct_values, double false_positive_ratio) {
+	// the optimal number of bits for a split block Bloom filter with eight bits per key
+	auto num_bits = -8.0 * double(num_distinct_values) / std::log(1.0 - std::pow(false_positive_ratio, 1.0 / 8.0));
+	if (!(num_bits < double(ParquetBloomFilter::MAX_BYTES * 8))) {
+		return ParquetBloomFilter::MAX_BYTES;
+	}
+	auto num_bytes = NextPowerOfTwo(MaxValue<idx_t>(idx_t(num_bits / 8), idx_t(ParquetBloomFilter::BYTES_PER_BLOCK)));
+	return MinValue<idx_t>(num_bytes, idx_t(ParquetBloomFilter::MAX_BYTES));
+}
+
+ParquetBloomFilter::ParquetBloomFilter(idx_t num_distinct_values, double false_positive_ratio)
+    : ParquetBloomFilter(BloomFilterSize(num_distinct_values, false_positive_ratio)) {
+}
+
+uint64_t ParquetBloomFilter::Hash(const_data_ptr_t data, idx_t size) {
+	return duckdb_zstd::XXH64(data, size, 0);
+}
+
+void ParquetBloomFilter::FilterInsert(uint64_t hash) {
+	auto block = blocks.get() + GetBlockIndex(hash) * WORDS_PER_BLOCK;
+	auto key = uint32_t(hash);
+	for (idx_t i = 0; i < WORDS_PER_BLOCK; i++) {
+		block[i] |= uint32_t(1) << ((key * BLOOM_FILTER_SALT[i]) >> 27);
+	}
+}
+
+bool ParquetBloomFilter::FilterCheck(uint64_t hash) const {
+	auto block = blocks.get() + GetBlockIndex(hash) * WORDS_PER_BLOCK;
+	auto key = uint32_t(hash);
+	for (idx_t i = 0; i < WORDS_PER_BLOCK; i++) {
+		if (!(block[i] & (uint32_t(1) << ((key * BLOOM_FILTER_SALT[i]) >> 27)))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+template <class T>
+static uint64_t BloomFilterHashValue(T value) {
+	return ParquetBloomFilter::Hash(const_data_ptr_cast(&value), sizeof(T));
+}
+
+// computes the hash of the plain encoding of a value - returns false if we cannot derive the plain encoding
+static bool TryGetBloomFilterHash(const ColumnReader &reader, const Value &value, uint64_t &result) {
+	if (value.IsNull() || value.type() != reader.Type()) {
+		return false;
+	}
+	auto physical_type = reader.Schema().type;
+	switch (reader.Type().id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+		if (physical_type != Type::INT32) {
+			return false;
+		}
+		result = BloomFilterHashValue<int32_t>(value.GetValue<int32_t>());
+		return true;
+	case LogicalTypeId::UINTEGER:
+		if (physical_type != Type::INT32) {
+			return false;
+		}
+		result = BloomFilterHashValue<uint32_t>(value.GetValue<uint32_t>());
+		return true;
+	case LogicalTypeId::DATE:
+		if (physical_type != Type::INT32) {
+			return false;
+		}
+		result = BloomFilterHashValue<int32_t>(value.GetValue<date_t>().days);
+		return true;
+	case LogicalTypeId::BIGINT:
+		if (physical_type != Type::INT64) {
+			return false;
+		}
+		result = BloomFilterHashValue<int64_t>(value.GetValue<int64_t>());
+		return true;
+	case LogicalTypeId::UBIGINT:
+		if (physical_type != Type::INT64) {
+			return false;
+		}
+		result = BloomFilterHashValue<uint64_t>(value.GetValue<uint64_t>());
+		return true;
+	case LogicalTypeId::FLOAT: {
+		auto float_value = value.GetValue<float>();
+		// -0.0 and 0.0 (and the different NaNs) compare equal but have different encodings
+		if (physical_type != Type::FLOAT || float_value == 0 || Value::IsNan(float_value)) {
+			return false;
+		}
+		result = BloomFilterHashValue<float>(float_value);
+		return true;
+	}
+	case LogicalTypeId::DOUBLE: {
+		auto double_value = value.GetValue<double>();
+		if (physical_type != Type::DOUBLE || double_value == 0 || Value::IsNan(double_value)) {
+			return false;
+		}
+		result = BloomFilterHashValue<double>(double_value);
+		return true;
+	}
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB: {
+		if (physical_type != Type::BYTE_ARRAY) {
+			return false;
+		}
+		auto &str = StringValue::Get(value);
+		result = ParquetBloomFilter::Hash(const_data_ptr_cast(str.c_str()), str.size());
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+bool ParquetStatisticsUtils::BloomFilterSupported(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+		return filter.Cast<ConstantFilter>().comparison_type == ExpressionType::COMPARE_EQUAL;
+	case TableFilterType::IN_FILTER:
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : and_filter.child_filters) {
+			if (BloomFilterSupported(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	default:
+		return false;
+	}
+}
+
+static bool BloomFilterExcludesValues(const ColumnReader &reader, const vector<Value> &values,
+                                      const ParquetBloomFilter &bloom_filter) {
+	for (auto &value : values) {
+		uint64_t hash;
+		if (!TryGetBloomFilterHash(reader, value, hash) || bloom_filter.FilterCheck(hash)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool ParquetStatisticsUtils::BloomFilterExcludes(const ColumnReader &reader, const TableFilter &filter,
+                                                 const ParquetBloomFilter &bloom_filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL) {
+			return false;
+		}
+		return BloomFilterExcludesValues(reader, {constant_filter.constant}, bloom_filter);
+	}
+	case TableFilterType::IN_FILTER:
+		return BloomFilterExcludesValues(reader, filter.Cast<InFilter>().values, bloom_filter);
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : and_filter.child_filters) {
+			if (BloomFilterExcludes(reader, *child_filter, bloom_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	default:
+		return false;
+	}
+}
+
 } // namespace duckdb
@@ -25,12 +25,14 @@ using namespace duckdb_apache::thrift;            // NOLINT
 using namespace duckdb_apache::thrift::protocol;  // NOLINT
 using namespace duckdb_apache::thrift::transport; // NOLINT
 
+using duckdb_parquet::format::ColumnIndex;
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::ConvertedType;
 using duckdb_parquet::format::Encoding;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::FileCryptoMetaData;
 using duckdb_parquet::format::FileMetaData;
+using duckdb_parquet::format::OffsetIndex;
 using duckdb_parquet::format::PageHeader;
 using duckdb_parquet::format::PageType;
 using ParquetRowGroup = duckdb_parquet::format::RowGroup;
@@ -319,11 +321,14 @@ ParquetWriter::ParquetWriter(ClientContext &context, FileSystem &fs, string file
                              const vector<pair<string, string>> &kv_metadata,
                              shared_ptr<ParquetEncryptionConfig> encryption_config_p,
                              double dictionary_compression_ratio_threshold_p, optional_idx compression_level_p,
-                             bool debug_use_openssl_p)
+                             bool debug_use_openssl_p, idx_t page_size_bytes_p,
+                             const vector<string> &bloom_filter_columns_p, double bloom_filter_false_positive_ratio_p)
     : file_name(std::move(file_name_p)), sql_types(std::move(types_p)), column_names(std::move(names_p)), codec(codec),
       field_ids(std::move(field_ids_p)), encryption_config(std::move(encryption_config_p)),
       dictionary_compression_ratio_threshold(dictionary_compression_ratio_threshold_p),
-      debug_use_openssl(debug_use_openssl_p) {
+      debug_use_openssl(debug_use_openssl_p), page_size_bytes(page_size_bytes_p),
+      bloom_filter_columns(bloom_filter_columns_p.begin(), bloom_filter_columns_p.end()),
+      bloom_filter_false_positive_ratio(bloom_filter_false_positive_ratio_p) {
 	// initialize the file writer
 	writer = make_uniq<BufferedFileWriter>(fs, file_name.c_str(),
 	                                       FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
@@ -514,6 +519,7 @@ void ParquetWriter::FlushRowGroup(PreparedRowGroup &prepared) {
 	}
 	// let's make sure all offsets are ay-okay
 	ValidateColumnOffsets(file_name, writer->GetTotalWritten(), row_group);
+	WriteBloomFilters(row_group);
 
 	// append the row group to the file meta data
 	file_meta_data.row_groups.push_back(row_group);
@@ -534,7 +540,81 @@ void ParquetWriter::Flush(ColumnDataCollection &buffer) {
 	FlushRowGroup(prepared_row_group);
 }
 
+void ParquetWriter::RegisterPageIndex(idx_t column_idx, unique_ptr<ColumnIndex> column_index,
+                                      unique_ptr<OffsetIndex> offset_index) {
+	if (encryption_config) {
+		// encrypted page indexes require their own module AADs - we do not write them
+		return;
+	}
+	ColumnChunkPageIndex page_index;
+	// this is called while flushing the row group, before it is appended to the file meta data
+	page_index.row_group_idx = file_meta_data.row_groups.size();
+	page_index.column_idx = column_idx;
+	page_index.column_index = std::move(column_index);
+	page_index.offset_index = std::move(offset_index);
+	page_indexes.push_back(std::move(page_index));
+}
+
+bool ParquetWriter::WriteBloomFilter(const vector<string> &schema_path) const {
+	// encrypted Bloom filters require their own module AADs - we do not write them
+	if (encryption_config || schema_path.size() != 1) {
+		return false;
+	}
+	return bloom_filter_columns.find(schema_path[0]) != bloom_filter_columns.end();
+}
+
+void ParquetWriter::RegisterBloomFilter(idx_t column_idx, unique_ptr<ParquetBloomFilter> bloom_filter) {
+	ColumnChunkBloomFilter column_bloom_filter;
+	column_bloom_filter.column_idx = column_idx;
+	column_bloom_filter.bloom_filter = std::move(bloom_filter);
+	bloom_filters.push_back(std::move(column_bloom_filter));
+}
+
+void ParquetWriter::WriteBloomFilters(duckdb_parquet::format::RowGroup &row_group) {
+	// the Bloom filters are written after all column chunks of the row group
+	// this keeps them out of the byte range that readers fetch when reading the row group
+	for (auto &column_bloom_filter : bloom_filters) {
+		auto &bloom_filter = *column_bloom_filter.bloom_filter;
+		duckdb_parquet::format::BloomFilterHeader header;
+		header.numBytes = NumericCast<int32_t>(bloom_filter.SizeInBytes());
+		header.algorithm.__set_BLOCK(duckdb_parquet::format::SplitBlockAlgorithm());
+		header.hash.__set_XXHASH(duckdb_parquet::format::XxHash());
+		header.compression.__set_UNCOMPRESSED(duckdb_parquet::format::Uncompressed());
+
+		auto start_offset = writer->GetTotalWritten();
+		Write(header);
+		WriteData(bloom_filter.GetData(), NumericCast<uint32_t>(bloom_filter.SizeInBytes()));
+
+		auto &column_chunk = row_group.columns[column_bloom_filter.column_idx];
+		column_chunk.meta_data.__set_bloom_filter_offset(NumericCast<int64_t>(start_offset));
+		column_chunk.meta_data.__set_bloom_filter_length(
+		    NumericCast<int32_t>(writer->GetTotalWritten() - start_offset));
+	}
+	bloom_filters.clear();
+}
+
+void ParquetWriter::WritePageIndexes() {
+	// the page index is written after all row groups and before the footer
+	// all column indexes are written first, followed by all offset indexes
+	for (auto &page_index : page_indexes) {
+		if (!page_index.column_index) {
+			continue;
+		}
+		auto &column_chunk = file_meta_data.row_groups[page_index.row_group_idx].columns[page_index.column_idx];
+		column_chunk.__set_column_index_offset(NumericCast<int64_t>(writer->GetTotalWritten()));
+		column_chunk.__set_column_index_length(NumericCast<int32_t>(Write(*page_index.column_index)));
+	}
+	for (auto &page_index : page_indexes) {
+		auto &column_chunk = file_meta_data.row_groups[page_index.row_group_idx].columns[page_index.column_idx];
+		column_chunk.__set_offset_index_offset(NumericCast<int64_t>(writer->GetTotalWritten()));
+		column_chunk.__set_offset_index_length(NumericCast<int32_t>(Write(*page_index.offset_index)));
+	}
+	page_indexes.clear();
+}
+
 void ParquetWriter::Finalize() {
+	WritePageIndexes();
+
 	const auto start_offset = writer->GetTotalWritten();
 	if (encryption_config) {
 		// Crypto metadata is written unencrypted
@@ -0,0 +1,55 @@
+#include "duckdb/common/numa.hpp"
+
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/operator/cast_operators.hpp"
+
+namespace duckdb {
+
+vector<vector<idx_t>> NUMA::GetNodeCPUs(FileSystem &fs) {
+	vector<vector<idx_t>> result;
+#if defined(__linux__) && !defined(DUCKDB_WASM)
+	const char *node_cpu_list = "/sys/devices/system/node/node%llu/cpulist";
+
+	for (idx_t node = 0;; node++) {
+		char cpu_list_path[256];
+		snprintf(cpu_list_path, sizeof(cpu_list_path), node_cpu_list, static_cast<unsigned long long>(node));
+		if (!fs.FileExists(cpu_list_path)) {
+			break;
+		}
+		auto handle = fs.OpenFile(cpu_list_path, FileFlags::FILE_FLAGS_READ);
+		char buffer[4096];
+		auto bytes_read = fs.Read(*handle, buffer, sizeof(buffer) - 1);
+		buffer[bytes_read] = '\0';
+
+		auto cpus = ParseCPUList(buffer);
+		if (cpus.empty()) {
+			// memory-only node
+			continue;
+		}
+		result.push_back(std::move(cpus));
+	}
+#endif
+	return result;
+}
+
+vector<idx_t> NUMA::ParseCPUList(const string &cpu_list) {
+	vector<idx_t> result;
+	for (auto &range : StringUtil::Split(StringUtil::Replace(cpu_list, "\n", ""), ',')) {
+		auto bounds = StringUtil::Split(range, '-');
+		idx_t start, end;
+		if (bounds.empty() || bounds.size() > 2 || !TryCast::Operation<string_t, idx_t>(string_t(bounds[0]), start)) {
+			return vector<idx_t>();
+		}
+		end = start;
+		if (bounds.size() == 2 && !TryCast::Operation<string_t, idx_t>(string_t(bounds[1]), end)) {
+			return vector<idx_t>();
+		}
+		for (idx_t cpu = start; cpu <= end; cpu++) {
+			result.push_back(cpu);
+		}
+	}
+	return result;
+}
+
+} // namespace duckdb
@@ -24,7 +24,7 @@ bool Comparators::TieIsBreakable(const idx_t &tie_col, const data_ptr_t &row_ptr
 	}
 	const auto &tie_col_offset = row_layout.GetOffsets()[col_idx];
 	auto tie_string = Load<string_t>(row_ptr + tie_col_offset);
-	if (tie_string.GetSize() < sort_layout.prefix_lengths[tie_col]) {
+	if (tie_string.GetSize() < sort_layout.prefix_offsets[tie_col] + sort_layout.prefix_lengths[tie_col]) {
 		// No need to break the tie - we already compared the full string
 		return false;
 	}
@@ -17,7 +17,11 @@ void MergeSorter::PerformInMergeRound() {
 			}
 			GetNextPartition();
 		}
-		MergePartition();
+		if (k_way_inputs.empty()) {
+			MergePartition();
+		} else {
+			MergeKWayPartition();
+		}
 	}
 }
 
@@ -44,7 +48,7 @@ void MergeSorter::MergePartition() {
 #endif
 	// Set up the write block
 	// Each merge task produces a SortedBlock with exactly state.block_capacity rows or less
-	result->InitializeWrite();
+	result->InitializeWrite(left->Remaining() + right->Remaining());
 	// Initialize arrays to store merge data
 	bool left_smaller[STANDARD_VECTOR_SIZE];
 	idx_t next_entry_sizes[STANDARD_VECTOR_SIZE];
@@ -81,13 +85,266 @@ void MergeSorter::MergePartition() {
 #endif
 }
 
+void MergeSorter::MergeKWayPartition() {
+	idx_t total_count = 0;
+	for (auto &reader : k_way_readers) {
+		total_count += reader->Remaining();
+	}
+	// Set up the write block
+	// Each merge task produces a SortedBlock with exactly state.block_capacity rows or less
+	result->InitializeWrite(total_count);
+	// Initialize arrays to store merge data
+	idx_t next_sources[STANDARD_VECTOR_SIZE];
+	idx_t next_entry_sizes[STANDARD_VECTOR_SIZE];
+	// Merge loop, every row is read and written once
+	idx_t merged = 0;
+	while (merged < total_count) {
+		const idx_t next = MinValue(total_count - merged, (idx_t)STANDARD_VECTOR_SIZE);
+		ComputeKWayMerge(next, next_sources);
+		// Actually merge the data (radix, blob, and payload)
+		MergeKWayRadix(next, next_sources);
+		if (!sort_layout.all_constant) {
+			MergeKWayData(*result->blob_sorting_data, next, next_sources, next_entry_sizes, true);
+			D_ASSERT(result->radix_sorting_data.size() == result->blob_sorting_data->data_blocks.size());
+		}
+		MergeKWayData(*result->payload_data, next, next_sources, next_entry_sizes, false);
+		D_ASSERT(result->radix_sorting_data.size() == result->payload_data->data_blocks.size());
+		merged += next;
+	}
+	D_ASSERT(result->Count() == total_count);
+	k_way_readers.clear();
+	k_way_inputs.clear();
+}
+
+bool MergeSorter::PositionKWayReader(SBScanState &reader) {
+	auto &blocks = reader.sb->radix_sorting_data;
+	while (reader.block_idx < blocks.size() && reader.entry_idx == blocks[reader.block_idx]->count) {
+		reader.block_idx++;
+		reader.entry_idx = 0;
+	}
+	if (reader.block_idx == blocks.size()) {
+		return false;
+	}
+	reader.PinRadix(reader.block_idx);
+	if (!sort_layout.all_constant) {
+		reader.PinData(*reader.sb->blob_sorting_data);
+	}
+	return true;
+}
+
+bool MergeSorter::KWayRowBefore(const idx_t a, const idx_t b) {
+	auto &l = *k_way_readers[a];
+	auto &r = *k_way_readers[b];
+	int comp_res;
+	if (sort_layout.all_constant) {
+		comp_res = FastMemcmp(l.RadixPtr(), r.RadixPtr(), sort_layout.comparison_size);
+	} else {
+		comp_res = Comparators::CompareTuple(l, r, l.RadixPtr(), r.RadixPtr(), sort_layout, state.external);
+	}
+	// Ties are won by earlier blocks, like in GetKWayRank
+	return comp_res < 0 || (comp_res == 0 && a < b);
+}
+
+void MergeSorter::ComputeKWayMerge(const idx_t &count, idx_t next_sources[]) {
+	auto &readers = k_way_readers;
+	// Save indices to restore afterwards
+	vector<pair<idx_t, idx_t>> indices_before;
+	// Binary heap of the readers that have rows left, the reader with the smallest next row is at the top
+	vector<idx_t> heap;
+	for (idx_t r_idx = 0; r_idx < readers.size(); r_idx++) {
+		indices_before.emplace_back(readers[r_idx]->block_idx, readers[r_idx]->entry_idx);
+		if (PositionKWayReader(*readers[r_idx])) {
+			heap.push_back(r_idx);
+		}
+	}
+	auto sift_down = [&](idx_t pos) {
+		const idx_t heap_size = heap.size();
+		while (true) {
+			const idx_t child = 2 * pos + 1;
+			if (child >= heap_size) {
+				break;
+			}
+			idx_t smallest = child;
+			if (child + 1 < heap_size && KWayRowBefore(heap[child + 1], heap[child])) {
+				smallest = child + 1;
+			}
+			if (!KWayRowBefore(heap[smallest], heap[pos])) {
+				break;
+			}
+			std::swap(heap[pos], heap[smallest]);
+			pos = smallest;
+		}
+	};
+	for (idx_t pos = heap.size() / 2; pos > 0; pos--) {
+		sift_down(pos - 1);
+	}
+	// Compute the merge of the next 'count' tuples
+	for (idx_t compared = 0; compared < count; compared++) {
+		D_ASSERT(!heap.empty());
+		const auto r_idx = heap[0];
+		next_sources[compared] = r_idx;
+		auto &reader = *readers[r_idx];
+		reader.entry_idx++;
+		if (!PositionKWayReader(reader)) {
+			// This reader is exhausted, replace it with the last reader in the heap
+			heap[0] = heap.back();
+			heap.pop_back();
+		}
+		sift_down(0);
+	}
+	// Reset block indices
+	for (idx_t r_idx = 0; r_idx < readers.size(); r_idx++) {
+		readers[r_idx]->SetIndices(indices_before[r_idx].first, indices_before[r_idx].second);
+	}
+}
+
+void MergeSorter::MergeKWayRadix(const idx_t &count, const idx_t next_sources[]) {
+	auto &readers = k_way_readers;
+	// Save indices to restore afterwards
+	vector<pair<idx_t, idx_t>> indices_before;
+	for (auto &reader : readers) {
+		indices_before.emplace_back(reader->block_idx, reader->entry_idx);
+	}
+
+	RowDataBlock *result_block = result->radix_sorting_data.back().get();
+	auto result_handle = buffer_manager.Pin(result_block->block);
+	data_ptr_t result_ptr = result_handle.Ptr() + result_block->count * sort_layout.entry_size;
+	D_ASSERT(result_block->count + count <= result_block->capacity);
+
+	for (idx_t copied = 0; copied < count; copied++) {
+		auto &reader = *readers[next_sources[copied]];
+		auto &blocks = reader.sb->radix_sorting_data;
+		// Move to the next block (if needed)
+		while (reader.entry_idx == blocks[reader.block_idx]->count) {
+			// Delete reference to previous block
+			blocks[reader.block_idx]->block = nullptr;
+			// Advance block
+			reader.block_idx++;
+			reader.entry_idx = 0;
+		}
+		reader.PinRadix(reader.block_idx);
+		FastMemcpy(result_ptr, reader.RadixPtr(), sort_layout.entry_size);
+		result_ptr += sort_layout.entry_size;
+		reader.entry_idx++;
+	}
+	result_block->count += count;
+	// Reset block indices
+	for (idx_t r_idx = 0; r_idx < readers.size(); r_idx++) {
+		readers[r_idx]->SetIndices(indices_before[r_idx].first, indices_before[r_idx].second);
+	}
+}
+
+void MergeSorter::MergeKWayData(SortedData &result_data, const idx_t &count, const idx_t next_sources[],
+                                idx_t next_entry_sizes[], bool reset_indices) {
+	auto &readers = k_way_readers;
+	// Save indices to restore afterwards
+	vector<pair<idx_t, idx_t>> indices_before;
+	for (auto &reader : readers) {
+		indices_before.emplace_back(reader->block_idx, reader->entry_idx);
+	}
+	auto get_source_data = [&](SBScanState &reader) -> SortedData & {
+		return result_data.type == SortedDataType::BLOB ? *reader.sb->blob_sorting_data : *reader.sb->payload_data;
+	};
+
+	const auto &layout = result_data.layout;
+	const idx_t row_width = layout.GetRowWidth();
+	const idx_t heap_pointer_offset = layout.GetHeapOffset();
+	// If all constant size, or if we are doing an in-memory sort, we do not need to touch the heap
+	const bool has_heap = !layout.AllConstant() && state.external;
+
+	// Result rows to write to
+	RowDataBlock *result_data_block = result_data.data_blocks.back().get();
+	auto result_data_handle = buffer_manager.Pin(result_data_block->block);
+	data_ptr_t result_data_ptr = result_data_handle.Ptr() + result_data_block->count * row_width;
+	D_ASSERT(result_data_block->count + count <= result_data_block->capacity);
+	// Result heap to write to (if needed)
+	RowDataBlock *result_heap_block = nullptr;
+	BufferHandle result_heap_handle;
+	if (has_heap) {
+		result_heap_block = result_data.heap_blocks.back().get();
+		result_heap_handle = buffer_manager.Pin(result_heap_block->block);
+		// Compute the entry sizes and number of heap bytes that will be copied
+		idx_t copy_bytes = 0;
+		for (idx_t i = 0; i < count; i++) {
+			auto &reader = *readers[next_sources[i]];
+			auto &source_data = get_source_data(reader);
+			while (reader.entry_idx == source_data.data_blocks[reader.block_idx]->count) {
+				reader.block_idx++;
+				reader.entry_idx = 0;
+			}
+			reader.PinData(source_data);
+			next_entry_sizes[i] = Load<uint32_t>(reader.HeapPtr(source_data));
+			D_ASSERT(next_entry_sizes[i] >= sizeof(uint32_t));
+			copy_bytes += next_entry_sizes[i];
+			reader.entry_idx++;
+		}
+		for (idx_t r_idx = 0; r_idx < readers.size(); r_idx++) {
+			readers[r_idx]->SetIndices(indices_before[r_idx].first, indices_before[r_idx].second);
+		}
+		// Reallocate result heap block size (if needed)
+		if (result_heap_block->byte_offset + copy_bytes > result_heap_block->capacity) {
+			idx_t new_capacity = result_heap_block->byte_offset + copy_bytes;
+			buffer_manager.ReAllocate(result_heap_block->block, new_capacity);
+			result_heap_block->capacity = new_capacity;
+		}
+	}
+
+	for (idx_t copied = 0; copied < count; copied++) {
+		auto &reader = *readers[next_sources[copied]];
+		auto &source_data = get_source_data(reader);
+		// Move to new data blocks (if needed)
+		while (reader.entry_idx == source_data.data_blocks[reader.block_idx]->count) {
+			// Delete reference to previous block
+			source_data.data_blocks[reader.block_idx]->block = nullptr;
+			if (has_heap) {
+				source_data.heap_blocks[reader.block_idx]->block = nullptr;
+			}
+			// Advance block
+			reader.block_idx++;
+			reader.entry_idx = 0;
+		}
+		reader.PinData(source_data);
+		const data_ptr_t source_ptr = reader.DataPtr(source_data);
+		if (has_heap) {
+			// Copy the heap entry, and store its offset in the result heap in the row data
+			const data_ptr_t source_heap_ptr = reader.HeapPtr(source_data);
+			const auto &entry_size = next_entry_sizes[copied];
+			memcpy(result_heap_handle.Ptr() + result_heap_block->byte_offset, source_heap_ptr, entry_size);
+			FastMemcpy(result_data_ptr, source_ptr, row_width);
+			Store<idx_t>(result_heap_block->byte_offset, result_data_ptr + heap_pointer_offset);
+			result_heap_block->byte_offset += entry_size;
+		} else {
+			FastMemcpy(result_data_ptr, source_ptr, row_width);
+		}
+		result_data_ptr += row_width;
+		reader.entry_idx++;
+	}
+	// Update result counts
+	result_data_block->count += count;
+	if (has_heap) {
+		result_heap_block->count += count;
+		D_ASSERT(result_heap_block->byte_offset <= result_heap_block->capacity);
+	}
+	if (reset_indices) {
+		for (idx_t r_idx = 0; r_idx < readers.size(); r_idx++) {
+			readers[r_idx]->SetIndices(indices_before[r_idx].first, indices_before[r_idx].second);
+		}
+	}
+}
+
 void MergeSorter::GetNextPartition() {
 	// Create result block
 	state.sorted_blocks_temp[state.pair_idx].push_back(make_uniq<SortedBlock>(buffer_manager, state));
 	result = state.sorted_blocks_temp[state.pair_idx].back().get();
 	// Determine which blocks must be merged
-	auto &left_block = *state.sorted_blocks[state.pair_idx * 2];
-	auto &right_block = *state.sorted_blocks[state.pair_idx * 2 + 1];
+	const idx_t block_start = state.pair_idx * state.merge_fan_in;
+	const idx_t block_count = MinValue(state.merge_fan_in, state.sorted_blocks.size() - block_start);
+	if (block_count > 2) {
+		GetNextKWayPartition(block_start, block_count);
+		return;
+	}
+	auto &left_block = *state.sorted_blocks[block_start];
+	auto &right_block = *state.sorted_blocks[block_start + 1];
 	const idx_t l_count = left_block.Count();
 	const idx_t r_count = right_block.Count();
 	// Initialize left and right reader
@@ -97,8 +354,8 @@ void MergeSorter::GetNextPartition() {
 	idx_t l_end;
 	idx_t r_end;
 	if (state.l_start + state.r_start + state.block_capacity < l_count + r_count) {
-		left->sb = state.sorted_blocks[state.pair_idx * 2].get();
-		right->sb = state.sorted_blocks[state.pair_idx * 2 + 1].get();
+		left->sb = state.sorted_blocks[block_start].get();
+		right->sb = state.sorted_blocks[block_start + 1].get();
 		const idx_t intersection = state.l_start + state.r_start + state.block_capacity;
 		GetIntersection(intersection, l_end, r_end);
 		D_ASSERT(l_end <= l_count);
@@ -121,8 +378,8 @@ void MergeSorter::GetNextPartition() {
 	// Update global state
 	if (state.l_start == l_count && state.r_start == r_count) {
 		// Delete references to previous pair
-		state.sorted_blocks[state.pair_idx * 2] = nullptr;
-		state.sorted_blocks[state.pair_idx * 2 + 1] = nullptr;
+		state.sorted_blocks[block_start] = nullptr;
+		state.sorted_blocks[block_start + 1] = nullptr;
 		// Advance pair
 		state.pair_idx++;
 		state.l_start = 0;
@@ -142,6 +399,13 @@ int MergeSorter::CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const i
 		return 1;
 	}
 
+	return CompareAtGlobalIndex(l, r, l_idx, r_idx);
+}
+
+int MergeSorter::CompareAtGlobalIndex(SBScanState &l, SBScanState &r, const idx_t l_idx, const idx_t r_idx) {
+	D_ASSERT(l_idx < l.sb->Count());
+	D_ASSERT(r_idx < r.sb->Count());
+
 	l.sb->GlobalToLocalIndex(l_idx, l.block_idx, l.entry_idx);
 	r.sb->GlobalToLocalIndex(r_idx, r.block_idx, r.entry_idx);
 
@@ -239,6 +503,117 @@ void MergeSorter::GetIntersection(const idx_t diagonal, idx_t &l_idx, idx_t &r_i
 	}
 }
 
+void MergeSorter::GetNextKWayPartition(const idx_t block_start, const idx_t block_count) {
+	auto &starts = state.k_way_starts;
+	if (starts.empty()) {
+		starts.resize(block_count, 0);
+	}
+	D_ASSERT(starts.size() == block_count);
+	// Initialize a reader for every block
+	vector<unique_ptr<SBScanState>> readers;
+	vector<idx_t> counts;
+	idx_t diagonal = state.block_capacity;
+	idx_t total_count = 0;
+	for (idx_t b_idx = 0; b_idx < block_count; b_idx++) {
+		readers.push_back(make_uniq<SBScanState>(buffer_manager, state));
+		readers.back()->sb = state.sorted_blocks[block_start + b_idx].get();
+		counts.push_back(readers.back()->sb->Count());
+		diagonal += starts[b_idx];
+		total_count += counts.back();
+	}
+	// Compute the work that this thread must do using Merge Path
+	vector<idx_t> ends(block_count);
+	if (diagonal < total_count) {
+		GetKWayIntersection(diagonal, readers, ends);
+	} else {
+		ends = counts;
+	}
+	readers.clear();
+	// Create slices of the data that this thread must merge, we skip empty slices as long as two slices remain
+	D_ASSERT(k_way_readers.empty() && k_way_inputs.empty());
+	bool done = true;
+	for (idx_t b_idx = 0; b_idx < block_count; b_idx++) {
+		D_ASSERT(starts[b_idx] <= ends[b_idx] && ends[b_idx] <= counts[b_idx]);
+		const bool empty = starts[b_idx] == ends[b_idx];
+		if (!empty || k_way_inputs.size() + block_count - b_idx <= 2) {
+			auto reader = make_uniq<SBScanState>(buffer_manager, state);
+			reader->SetIndices(0, 0);
+			auto &sorted_block = *state.sorted_blocks[block_start + b_idx];
+			k_way_inputs.push_back(sorted_block.CreateSlice(starts[b_idx], ends[b_idx], reader->entry_idx));
+			reader->sb = k_way_inputs.back().get();
+			k_way_readers.push_back(std::move(reader));
+		}
+		starts[b_idx] = ends[b_idx];
+		done = done && ends[b_idx] == counts[b_idx];
+	}
+	// Update global state
+	if (done) {
+		// Delete references to previous blocks
+		for (idx_t b_idx = 0; b_idx < block_count; b_idx++) {
+			state.sorted_blocks[block_start + b_idx] = nullptr;
+		}
+		// Advance pair
+		state.pair_idx++;
+		starts.clear();
+	}
+}
+
+void MergeSorter::GetKWayIntersection(const idx_t diagonal, vector<unique_ptr<SBScanState>> &readers,
+                                      vector<idx_t> &ends) {
+	auto &starts = state.k_way_starts;
+	// The partition holds block_capacity rows, so the rows that bound it lie within these bounds
+	vector<idx_t> bounds;
+	for (idx_t b_idx = 0; b_idx < readers.size(); b_idx++) {
+		bounds.push_back(MinValue(readers[b_idx]->sb->Count(), starts[b_idx] + state.block_capacity + 1));
+	}
+	// The row with exactly 'diagonal' rows before it is in one of the blocks: binary search the blocks for it
+	for (idx_t b_idx = 0; b_idx < readers.size(); b_idx++) {
+		idx_t lower = starts[b_idx];
+		idx_t upper = bounds[b_idx];
+		while (lower < upper) {
+			const idx_t middle = lower + (upper - lower) / 2;
+			const idx_t rank = GetKWayRank(readers, bounds, b_idx, middle, ends);
+			if (rank == diagonal) {
+				return;
+			} else if (rank < diagonal) {
+				lower = middle + 1;
+			} else {
+				upper = middle;
+			}
+		}
+	}
+	throw InternalException("Could not find the k-way Merge Path intersection");
+}
+
+idx_t MergeSorter::GetKWayRank(vector<unique_ptr<SBScanState>> &readers, const vector<idx_t> &bounds,
+                               const idx_t block_idx, const idx_t idx, vector<idx_t> &ends) {
+	auto &starts = state.k_way_starts;
+	idx_t rank = 0;
+	for (idx_t b_idx = 0; b_idx < readers.size(); b_idx++) {
+		if (b_idx == block_idx) {
+			ends[b_idx] = idx;
+			rank += idx;
+			continue;
+		}
+		// Binary search for the first row that comes after the row at 'idx' (ties are won by earlier blocks)
+		idx_t lower = starts[b_idx];
+		idx_t upper = bounds[b_idx];
+		while (lower < upper) {
+			const idx_t middle = lower + (upper - lower) / 2;
+			const int comp_res = CompareAtGlobalIndex(*readers[b_idx], *readers[block_idx], middle, idx);
+			const bool after = b_idx < block_idx ? comp_res > 0 : comp_res >= 0;
+			if (after) {
+				upper = middle;
+			} else {
+				lower = middle + 1;
+			}
+		}
+		ends[b_idx] = lower;
+		rank += lower;
+	}
+	return rank;
+}
+
 void MergeSorter::ComputeMerge(const idx_t &count, bool left_smaller[]) {
 	auto &l = *left;
 	auto &r = *right;
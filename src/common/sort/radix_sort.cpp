@@ -5,6 +5,25 @@
 
 namespace duckdb {
 
+//! A string that is tied by its prefix, and the sorting key entry it belongs to
+struct TiedString {
+	string_t value;
+	data_ptr_t entry_ptr;
+};
+
+//! Compares two strings that are tied on their first 'tied_bytes' bytes (or on all their bytes, if shorter)
+static inline int CompareTiedStrings(const string_t &l, const string_t &r, idx_t tied_bytes) {
+	const auto l_size = l.GetSize();
+	const auto r_size = r.GetSize();
+	const auto min_size = MinValue(l_size, r_size);
+	tied_bytes = MinValue<idx_t>(tied_bytes, min_size);
+	const auto comp_res = memcmp(l.GetData() + tied_bytes, r.GetData() + tied_bytes, min_size - tied_bytes);
+	if (comp_res != 0) {
+		return comp_res;
+	}
+	return l_size < r_size ? -1 : l_size > r_size;
+}
+
 //! Calls std::sort on strings that are tied by their prefix after the radix sort
 static void SortTiedBlobs(BufferManager &buffer_manager, const data_ptr_t dataptr, const idx_t &start, const idx_t &end,
                           const idx_t &tie_col, bool *ties, const data_ptr_t blob_ptr, const SortLayout &sort_layout) {
@@ -23,20 +42,41 @@ static void SortTiedBlobs(BufferManager &buffer_manager, const data_ptr_t datapt
 		entry_ptrs[i - start] = row_ptr;
 		row_ptr += sort_layout.entry_size;
 	}
-	// Slow pointer-based sorting
 	const int order = sort_layout.order_types[tie_col] == OrderType::DESCENDING ? -1 : 1;
 	const idx_t &col_idx = sort_layout.sorting_to_blob_col.at(tie_col);
 	const auto &tie_col_offset = sort_layout.blob_layout.GetOffsets()[col_idx];
 	auto logical_type = sort_layout.blob_layout.GetTypes()[col_idx];
-	std::sort(entry_ptrs, entry_ptrs + end - start,
-	          [&blob_ptr, &order, &sort_layout, &tie_col_offset, &row_width, &logical_type](const data_ptr_t l,
-	                                                                                        const data_ptr_t r) {
-		          idx_t left_idx = Load<uint32_t>(l + sort_layout.comparison_size);
-		          idx_t right_idx = Load<uint32_t>(r + sort_layout.comparison_size);
-		          data_ptr_t left_ptr = blob_ptr + left_idx * row_width + tie_col_offset;
-		          data_ptr_t right_ptr = blob_ptr + right_idx * row_width + tie_col_offset;
-		          return order * Comparators::CompareVal(left_ptr, right_ptr, logical_type) < 0;
-	          });
+	const bool is_string = logical_type.InternalType() == PhysicalType::VARCHAR;
+	// The strings are equal up to (and including) the bytes in the sorting key, so we skip these when comparing
+	const idx_t tied_bytes = sort_layout.prefix_offsets[tie_col] + sort_layout.prefix_lengths[tie_col];
+	unsafe_unique_array<TiedString> tied_strings;
+	if (is_string) {
+		// Load the strings once, instead of going through the blob rows for every comparison
+		tied_strings = make_unsafe_uniq_array_uninitialized<TiedString>(end - start);
+		for (idx_t i = 0; i < end - start; i++) {
+			idx_t blob_idx = Load<uint32_t>(entry_ptrs[i] + sort_layout.comparison_size);
+			tied_strings[i].value = Load<string_t>(blob_ptr + blob_idx * row_width + tie_col_offset);
+			tied_strings[i].entry_ptr = entry_ptrs[i];
+		}
+		std::sort(tied_strings.get(), tied_strings.get() + end - start,
+		          [&order, &tied_bytes](const TiedString &l, const TiedString &r) {
+			          return order * CompareTiedStrings(l.value, r.value, tied_bytes) < 0;
+		          });
+		for (idx_t i = 0; i < end - start; i++) {
+			entry_ptrs[i] = tied_strings[i].entry_ptr;
+		}
+	} else {
+		// Slow pointer-based sorting
+		std::sort(entry_ptrs, entry_ptrs + end - start,
+		          [&blob_ptr, &order, &sort_layout, &tie_col_offset, &row_width, &logical_type](const data_ptr_t l,
+		                                                                                        const data_ptr_t r) {
+			          idx_t left_idx = Load<uint32_t>(l + sort_layout.comparison_size);
+			          idx_t right_idx = Load<uint32_t>(r + sort_layout.comparison_size);
+			          data_ptr_t left_ptr = blob_ptr + left_idx * row_width + tie_col_offset;
+			          data_ptr_t right_ptr = blob_ptr + right_idx * row_width + tie_col_offset;
+			          return order * Comparators::CompareVal(left_ptr, right_ptr, logical_type) < 0;
+		          });
+	}
 	// Re-order
 	auto temp_block = buffer_manager.GetBufferAllocator().Allocate((end - start) * sort_layout.entry_size);
 	data_ptr_t temp_ptr = temp_block.get();
@@ -47,6 +87,12 @@ static void SortTiedBlobs(BufferManager &buffer_manager, const data_ptr_t datapt
 	memcpy(dataptr + start * sort_layout.entry_size, temp_block.get(), (end - start) * sort_layout.entry_size);
 	// Determine if there are still ties (if this is not the last column)
 	if (tie_col < sort_layout.column_count - 1) {
+		if (is_string) {
+			for (idx_t i = 0; i < end - start - 1; i++) {
+				ties[start + i] = CompareTiedStrings(tied_strings[i].value, tied_strings[i + 1].value, tied_bytes) == 0;
+			}
+			return;
+		}
 		data_ptr_t idx_ptr = dataptr + start * sort_layout.entry_size + sort_layout.comparison_size;
 		// Load current entry
 		data_ptr_t current_ptr = blob_ptr + Load<uint32_t>(idx_ptr) * row_width + tie_col_offset;
@@ -42,6 +42,17 @@ idx_t GetNestedSortingColSize(idx_t &col_size, const LogicalType &type) {
 	}
 }
 
+//! Returns the length of the prefix that the min and max string statistics share. All strings in between share it too
+static idx_t GetCommonStringPrefixLength(const BaseStatistics &stats) {
+	const auto min = StringStats::Min(stats);
+	const auto max = StringStats::Max(stats);
+	idx_t length = 0;
+	while (length < min.size() && length < max.size() && min[length] == max[length]) {
+		length++;
+	}
+	return length;
+}
+
 SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
     : column_count(orders.size()), all_constant(true), comparison_size(0), entry_size(0) {
 	vector<LogicalType> blob_layout_types;
@@ -66,12 +77,17 @@ SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
 
 		idx_t col_size = has_null.back() ? 1 : 0;
 		prefix_lengths.push_back(0);
+		prefix_offsets.push_back(0);
 		if (!TypeIsConstantSize(physical_type) && physical_type != PhysicalType::VARCHAR) {
 			prefix_lengths.back() = GetNestedSortingColSize(col_size, expr.return_type);
 		} else if (physical_type == PhysicalType::VARCHAR) {
 			idx_t size_before = col_size;
+			if (stats.back()) {
+				prefix_offsets.back() = GetCommonStringPrefixLength(*stats.back());
+			}
 			if (stats.back() && StringStats::HasMaxStringLength(*stats.back())) {
-				col_size += StringStats::MaxStringLength(*stats.back());
+				col_size += MaxValue<idx_t>(StringStats::MaxStringLength(*stats.back()), prefix_offsets.back()) -
+				            prefix_offsets.back();
 				if (col_size > 12) {
 					col_size = 12;
 				} else {
@@ -100,7 +116,9 @@ SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
 			}
 			if (logical_types[col_idx].InternalType() == PhysicalType::VARCHAR && stats[col_idx] &&
 			    StringStats::HasMaxStringLength(*stats[col_idx])) {
-				idx_t diff = StringStats::MaxStringLength(*stats[col_idx]) - prefix_lengths[col_idx];
+				idx_t diff = MaxValue<idx_t>(StringStats::MaxStringLength(*stats[col_idx]),
+				                             prefix_offsets[col_idx] + prefix_lengths[col_idx]) -
+				             prefix_offsets[col_idx] - prefix_lengths[col_idx];
 				if (diff > 0) {
 					// Increase all sizes accordingly
 					idx_t increase = MinValue(bytes_to_fill, diff);
@@ -144,6 +162,7 @@ SortLayout SortLayout::GetPrefixComparisonLayout(idx_t num_prefix_cols) const {
 		result.column_sizes.push_back(column_sizes[col_idx]);
 
 		result.prefix_lengths.push_back(prefix_lengths[col_idx]);
+		result.prefix_offsets.push_back(prefix_offsets[col_idx]);
 		result.stats.push_back(stats[col_idx]);
 		result.has_null.push_back(has_null[col_idx]);
 	}
@@ -196,7 +215,7 @@ void LocalSortState::SinkChunk(DataChunk &sort, DataChunk &payload) {
 		bool desc = sort_layout->order_types[sort_col] == OrderType::DESCENDING;
 		RowOperations::RadixScatter(sort.data[sort_col], sort.size(), sel_ptr, sort.size(), data_pointers, desc,
 		                            has_null, nulls_first, sort_layout->prefix_lengths[sort_col],
-		                            sort_layout->column_sizes[sort_col]);
+		                            sort_layout->column_sizes[sort_col], 0, sort_layout->prefix_offsets[sort_col]);
 	}
 
 	// Also fully serialize blob sorting columns (to be able to break ties
@@ -366,7 +385,7 @@ void LocalSortState::ReOrder(GlobalSortState &gstate, bool reorder_heap) {
 GlobalSortState::GlobalSortState(BufferManager &buffer_manager, const vector<BoundOrderByNode> &orders,
                                  RowLayout &payload_layout)
     : buffer_manager(buffer_manager), sort_layout(SortLayout(orders)), payload_layout(payload_layout),
-      block_capacity(0), external(false) {
+      block_capacity(0), external(false), merge_fan_in(2) {
 }
 
 void GlobalSortState::AddLocalState(LocalSortState &local_sort_state) {
@@ -437,16 +456,19 @@ void GlobalSortState::InitializeMergeRound() {
 	// If we reverse this list, the blocks that were merged last will be merged first in the next round
 	// These are still in memory, therefore this reduces the amount of read/write to disk!
 	std::reverse(sorted_blocks.begin(), sorted_blocks.end());
-	// Uneven number of blocks - keep one on the side
-	if (sorted_blocks.size() % 2 == 1) {
+	// Merge up to MERGE_FAN_IN blocks at once, so a single k-way round replaces multiple rounds of pairwise merges
+	merge_fan_in = MaxValue<idx_t>(MinValue<idx_t>(sorted_blocks.size(), (idx_t)SortConstants::MERGE_FAN_IN), 2);
+	// A single block remains after dividing the blocks - keep it on the side
+	if (sorted_blocks.size() % merge_fan_in == 1) {
 		odd_one_out = std::move(sorted_blocks.back());
 		sorted_blocks.pop_back();
 	}
 	// Init merge path path indices
 	pair_idx = 0;
-	num_pairs = sorted_blocks.size() / 2;
+	num_pairs = (sorted_blocks.size() + merge_fan_in - 1) / merge_fan_in;
 	l_start = 0;
 	r_start = 0;
+	k_way_starts.clear();
 	// Allocate room for merge results
 	for (idx_t p_idx = 0; p_idx < num_pairs; p_idx++) {
 		sorted_blocks_temp.emplace_back();
@@ -24,9 +24,9 @@ idx_t SortedData::Count() {
 	return count;
 }
 
-void SortedData::CreateBlock() {
+void SortedData::CreateBlock(idx_t capacity) {
 	const auto block_size = buffer_manager.GetBlockSize();
-	auto capacity = MaxValue((block_size + layout.GetRowWidth() - 1) / layout.GetRowWidth(), state.block_capacity);
+	capacity = MaxValue((block_size + layout.GetRowWidth() - 1) / layout.GetRowWidth(), capacity);
 	data_blocks.push_back(make_uniq<RowDataBlock>(MemoryTag::ORDER_BY, buffer_manager, capacity, layout.GetRowWidth()));
 	if (!layout.AllConstant() && state.external) {
 		heap_blocks.push_back(make_uniq<RowDataBlock>(MemoryTag::ORDER_BY, buffer_manager, block_size, 1U));
@@ -94,17 +94,17 @@ idx_t SortedBlock::Count() const {
 	return count;
 }
 
-void SortedBlock::InitializeWrite() {
-	CreateBlock();
+void SortedBlock::InitializeWrite(idx_t capacity) {
+	CreateBlock(capacity);
 	if (!sort_layout.all_constant) {
-		blob_sorting_data->CreateBlock();
+		blob_sorting_data->CreateBlock(capacity);
 	}
-	payload_data->CreateBlock();
+	payload_data->CreateBlock(capacity);
 }
 
-void SortedBlock::CreateBlock() {
+void SortedBlock::CreateBlock(idx_t capacity) {
 	const auto block_size = buffer_manager.GetBlockSize();
-	auto capacity = MaxValue((block_size + sort_layout.entry_size - 1) / sort_layout.entry_size, state.block_capacity);
+	capacity = MaxValue((block_size + sort_layout.entry_size - 1) / sort_layout.entry_size, capacity);
 	radix_sorting_data.push_back(
 	    make_uniq<RowDataBlock>(MemoryTag::ORDER_BY, buffer_manager, capacity, sort_layout.entry_size));
 }
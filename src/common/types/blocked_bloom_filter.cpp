@@ -0,0 +1,55 @@
+#include "duckdb/common/types/blocked_bloom_filter.hpp"
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+
+namespace duckdb {
+
+BlockedBloomFilter::BlockedBloomFilter(idx_t expected_count) {
+	auto required_blocks = MaxValue<idx_t>(expected_count * BITS_PER_KEY / (sizeof(uint64_t) * 8), 1);
+	block_count = MinValue<idx_t>(NextPowerOfTwo(required_blocks), MAX_BLOCK_COUNT);
+	bitmask = block_count - 1;
+	blocks = make_unsafe_uniq_array<uint64_t>(block_count);
+}
+
+void BlockedBloomFilter::Insert(Vector &hashes, idx_t count, bool parallel) {
+	D_ASSERT(hashes.GetType().id() == LogicalType::HASH);
+	D_ASSERT(hashes.GetVectorType() == VectorType::FLAT_VECTOR);
+	const auto hash_data = FlatVector::GetData<hash_t>(hashes);
+	if (parallel) {
+		auto atomic_blocks = reinterpret_cast<atomic<uint64_t> *>(blocks.get());
+		for (idx_t i = 0; i < count; i++) {
+			const auto hash = hash_data[i];
+			const auto mask = GetMask(hash);
+			auto &block = atomic_blocks[GetBlockIndex(hash)];
+			if ((block.load(std::memory_order_relaxed) & mask) != mask) {
+				block.fetch_or(mask, std::memory_order_relaxed);
+			}
+		}
+	} else {
+		for (idx_t i = 0; i < count; i++) {
+			const auto hash = hash_data[i];
+			blocks[GetBlockIndex(hash)] |= GetMask(hash);
+		}
+	}
+}
+
+void BlockedBloomFilter::Serialize(Serializer &serializer) const {
+	serializer.WriteProperty(100, "block_count", block_count);
+	serializer.WriteProperty(101, "blocks", const_data_ptr_cast(blocks.get()), SizeInBytes());
+}
+
+shared_ptr<BlockedBloomFilter> BlockedBloomFilter::Deserialize(Deserializer &deserializer) {
+	auto block_count = deserializer.ReadProperty<idx_t>(100, "block_count");
+	if (!IsPowerOfTwo(block_count) || block_count > MAX_BLOCK_COUNT) {
+		throw SerializationException("Invalid block count for BlockedBloomFilter");
+	}
+	// the expected count maps back onto exactly block_count blocks
+	auto result = make_shared_ptr<BlockedBloomFilter>(block_count * sizeof(uint64_t) * 8 / BITS_PER_KEY);
+	D_ASSERT(result->block_count == block_count);
+	deserializer.ReadProperty(101, "blocks", data_ptr_cast(result->blocks.get()), result->SizeInBytes());
+	return result;
+}
+
+} // namespace duckdb
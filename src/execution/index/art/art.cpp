@@ -17,6 +17,7 @@
 #include "duckdb/planner/expression/bound_between_expression.hpp"
 #include "duckdb/planner/expression/bound_comparison_expression.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/storage/arena_allocator.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
@@ -30,6 +31,11 @@ struct ARTIndexScanState : public IndexScanState {
 	Value values[2];
 	//! The expressions over the scan predicates.
 	ExpressionType expressions[2];
+	//! Equality predicates on the leading key columns of a compound key.
+	//! The predicates in values apply to the key column following these columns.
+	vector<Value> prefix_values;
+	//! True, if values[0] is a string prefix, e.g., of a LIKE 'abc%' predicate.
+	bool is_string_prefix = false;
 	bool checked = false;
 	//! All scanned row IDs.
 	unsafe_vector<row_t> row_ids;
@@ -45,7 +51,7 @@ ART::ART(const string &name, const IndexConstraintType index_constraint_type, co
          const shared_ptr<array<unsafe_unique_ptr<FixedSizeAllocator>, ALLOCATOR_COUNT>> &allocators_ptr,
          const IndexStorageInfo &info)
     : BoundIndex(name, ART::TYPE_NAME, index_constraint_type, column_ids, table_io_manager, unbound_expressions, db),
-      allocators(allocators_ptr), owns_data(false) {
+      allocators(allocators_ptr), owns_data(false), active_lookups(0) {
 
 	// FIXME: Use the new byte representation function to support nested types.
 	for (idx_t i = 0; i < types.size(); i++) {
@@ -90,6 +96,9 @@ ART::ART(const string &name, const IndexConstraintType index_constraint_type, co
 		};
 		allocators =
 		    make_shared_ptr<array<unsafe_unique_ptr<FixedSizeAllocator>, ALLOCATOR_COUNT>>(std::move(allocator_array));
+		for (auto &allocator : *allocators) {
+			allocator->SetActiveLookups(active_lookups);
+		}
 	}
 
 	if (!info.IsValid()) {
@@ -112,30 +121,46 @@ ART::ART(const string &name, const IndexConstraintType index_constraint_type, co
 // Initialize Scans
 //===--------------------------------------------------------------------===//
 
-static unique_ptr<IndexScanState> InitializeScanSinglePredicate(const Value &value,
-                                                                const ExpressionType expression_type) {
-	auto result = make_uniq<ARTIndexScanState>();
-	result->values[0] = value;
-	result->expressions[0] = expression_type;
-	return std::move(result);
-}
+//! The predicates on a single key column of the ART.
+struct ARTScanPredicates {
+	Value equal_value;
+	Value low_value;
+	ExpressionType low_comparison_type = ExpressionType::INVALID;
+	Value high_value;
+	ExpressionType high_comparison_type = ExpressionType::INVALID;
+	Value prefix_value;
+};
 
-static unique_ptr<IndexScanState> InitializeScanTwoPredicates(const Value &low_value,
-                                                              const ExpressionType low_expression_type,
-                                                              const Value &high_value,
-                                                              const ExpressionType high_expression_type) {
-	auto result = make_uniq<ARTIndexScanState>();
-	result->values[0] = low_value;
-	result->expressions[0] = low_expression_type;
-	result->values[1] = high_value;
-	result->expressions[1] = high_expression_type;
-	return std::move(result);
+static void SetLowerBound(ARTScanPredicates &predicates, const Value &value, const ExpressionType comparison_type) {
+	if (!predicates.low_value.IsNull()) {
+		// We keep the tighter lower bound.
+		if (predicates.low_value > value) {
+			return;
+		}
+		if (predicates.low_value == value && comparison_type == ExpressionType::COMPARE_GREATERTHANOREQUALTO) {
+			return;
+		}
+	}
+	predicates.low_value = value;
+	predicates.low_comparison_type = comparison_type;
 }
 
-unique_ptr<IndexScanState> ART::TryInitializeScan(const Expression &expr, const Expression &filter_expr) {
-	Value low_value, high_value, equal_value;
-	ExpressionType low_comparison_type = ExpressionType::INVALID, high_comparison_type = ExpressionType::INVALID;
+static void SetUpperBound(ARTScanPredicates &predicates, const Value &value, const ExpressionType comparison_type) {
+	if (!predicates.high_value.IsNull()) {
+		// We keep the tighter upper bound.
+		if (predicates.high_value < value) {
+			return;
+		}
+		if (predicates.high_value == value && comparison_type == ExpressionType::COMPARE_LESSTHANOREQUALTO) {
+			return;
+		}
+	}
+	predicates.high_value = value;
+	predicates.high_comparison_type = comparison_type;
+}
 
+static void AddScanPredicates(const Expression &expr, const PhysicalType type, const Expression &filter_expr,
+                              ARTScanPredicates &predicates) {
 	// Try to find a matching index for any of the filter expressions.
 	ComparisonExpressionMatcher matcher;
 	// Match on a comparison type.
@@ -156,6 +181,9 @@ unique_ptr<IndexScanState> ART::TryInitializeScan(const Expression &expr, const
 		auto &comparison = bindings[0].get().Cast<BoundComparisonExpression>();
 		auto constant_value = bindings[2].get().Cast<BoundConstantExpression>().value;
 		auto comparison_type = comparison.type;
+		if (constant_value.IsNull() || constant_value.type().InternalType() != type) {
+			return;
+		}
 
 		if (comparison.left->type == ExpressionType::VALUE_CONSTANT) {
 			// The expression is on the right side, we flip the comparison expression.
@@ -164,59 +192,126 @@ unique_ptr<IndexScanState> ART::TryInitializeScan(const Expression &expr, const
 
 		if (comparison_type == ExpressionType::COMPARE_EQUAL) {
 			// An equality value overrides any other bounds.
-			equal_value = constant_value;
+			predicates.equal_value = constant_value;
 		} else if (comparison_type == ExpressionType::COMPARE_GREATERTHANOREQUALTO ||
 		           comparison_type == ExpressionType::COMPARE_GREATERTHAN) {
 			// This is a lower bound.
-			low_value = constant_value;
-			low_comparison_type = comparison_type;
-		} else {
+			SetLowerBound(predicates, constant_value, comparison_type);
+		} else if (comparison_type == ExpressionType::COMPARE_LESSTHANOREQUALTO ||
+		           comparison_type == ExpressionType::COMPARE_LESSTHAN) {
 			// This is an upper bound.
-			high_value = constant_value;
-			high_comparison_type = comparison_type;
+			SetUpperBound(predicates, constant_value, comparison_type);
 		}
+		return;
+	}
 
-	} else if (filter_expr.type == ExpressionType::COMPARE_BETWEEN) {
+	if (filter_expr.type == ExpressionType::COMPARE_BETWEEN) {
 		auto &between = filter_expr.Cast<BoundBetweenExpression>();
 		if (!between.input->Equals(expr)) {
 			// The expression does not match the index expression.
-			return nullptr;
+			return;
 		}
 
 		if (between.lower->type != ExpressionType::VALUE_CONSTANT ||
 		    between.upper->type != ExpressionType::VALUE_CONSTANT) {
 			// Not a constant expression.
-			return nullptr;
+			return;
 		}
 
-		low_value = between.lower->Cast<BoundConstantExpression>().value;
-		low_comparison_type = between.lower_inclusive ? ExpressionType::COMPARE_GREATERTHANOREQUALTO
-		                                              : ExpressionType::COMPARE_GREATERTHAN;
-		high_value = (between.upper->Cast<BoundConstantExpression>()).value;
-		high_comparison_type =
-		    between.upper_inclusive ? ExpressionType::COMPARE_LESSTHANOREQUALTO : ExpressionType::COMPARE_LESSTHAN;
+		auto &low_value = between.lower->Cast<BoundConstantExpression>().value;
+		auto &high_value = between.upper->Cast<BoundConstantExpression>().value;
+		if (low_value.IsNull() || high_value.IsNull() || low_value.type().InternalType() != type ||
+		    high_value.type().InternalType() != type) {
+			return;
+		}
+		SetLowerBound(predicates, low_value,
+		              between.lower_inclusive ? ExpressionType::COMPARE_GREATERTHANOREQUALTO
+		                                      : ExpressionType::COMPARE_GREATERTHAN);
+		SetUpperBound(predicates, high_value,
+		              between.upper_inclusive ? ExpressionType::COMPARE_LESSTHANOREQUALTO
+		                                      : ExpressionType::COMPARE_LESSTHAN);
+		return;
 	}
 
-	// We cannot use an index scan.
-	if (equal_value.IsNull() && low_value.IsNull() && high_value.IsNull()) {
-		return nullptr;
+	if (filter_expr.expression_class == ExpressionClass::BOUND_FUNCTION && type == PhysicalType::VARCHAR) {
+		// The LIKE optimizer rewrites LIKE 'abc%' into prefix(s, 'abc').
+		auto &func = filter_expr.Cast<BoundFunctionExpression>();
+		auto &name = func.function.name;
+		if (name != "prefix" && name != "starts_with" && name != "^@") {
+			return;
+		}
+		if (func.children.size() != 2 || !func.children[0]->Equals(expr) ||
+		    func.children[1]->type != ExpressionType::VALUE_CONSTANT) {
+			return;
+		}
+		auto &prefix_value = func.children[1]->Cast<BoundConstantExpression>().value;
+		if (prefix_value.IsNull() || prefix_value.type().id() != LogicalTypeId::VARCHAR) {
+			return;
+		}
+		predicates.prefix_value = prefix_value;
 	}
+}
 
-	// Initialize the index scan state and return it.
-	if (!equal_value.IsNull()) {
-		// Equality predicate.
-		return InitializeScanSinglePredicate(equal_value, ExpressionType::COMPARE_EQUAL);
-	}
-	if (!low_value.IsNull() && !high_value.IsNull()) {
-		// Two-sided predicate.
-		return InitializeScanTwoPredicates(low_value, low_comparison_type, high_value, high_comparison_type);
+unique_ptr<IndexScanState> ART::TryInitializeScan(const vector<unique_ptr<Expression>> &exprs,
+                                                  const vector<unique_ptr<Expression>> &filter_exprs) {
+	D_ASSERT(exprs.size() == types.size());
+	auto result = make_uniq<ARTIndexScanState>();
+
+	// We match the filters against the key columns from left to right.
+	// Equality predicates on the leading columns form the prefix of the key range,
+	// and the first column without an equality predicate bounds the key range.
+	for (idx_t i = 0; i < exprs.size(); i++) {
+		ARTScanPredicates predicates;
+		for (auto &filter_expr : filter_exprs) {
+			AddScanPredicates(*exprs[i], types[i], *filter_expr, predicates);
+		}
+
+		if (!predicates.equal_value.IsNull()) {
+			if (i + 1 < exprs.size()) {
+				result->prefix_values.push_back(predicates.equal_value);
+				continue;
+			}
+			// Equality predicate on all key columns.
+			result->values[0] = predicates.equal_value;
+			result->expressions[0] = ExpressionType::COMPARE_EQUAL;
+			return std::move(result);
+		}
+
+		if (!predicates.low_value.IsNull() && !predicates.high_value.IsNull()) {
+			// Two-sided predicate.
+			result->values[0] = predicates.low_value;
+			result->expressions[0] = predicates.low_comparison_type;
+			result->values[1] = predicates.high_value;
+			result->expressions[1] = predicates.high_comparison_type;
+			return std::move(result);
+		}
+		if (!predicates.low_value.IsNull()) {
+			// Greater-than predicate.
+			result->values[0] = predicates.low_value;
+			result->expressions[0] = predicates.low_comparison_type;
+			return std::move(result);
+		}
+		if (!predicates.high_value.IsNull()) {
+			// Less-than predicate.
+			result->values[0] = predicates.high_value;
+			result->expressions[0] = predicates.high_comparison_type;
+			return std::move(result);
+		}
+		if (!predicates.prefix_value.IsNull()) {
+			// String prefix predicate.
+			result->values[0] = predicates.prefix_value;
+			result->is_string_prefix = true;
+			return std::move(result);
+		}
+		break;
 	}
-	if (!low_value.IsNull()) {
-		// Less-than predicate.
-		return InitializeScanSinglePredicate(low_value, low_comparison_type);
+
+	// We cannot use an index scan.
+	if (result->prefix_values.empty()) {
+		return nullptr;
 	}
-	// Greater-than predicate.
-	return InitializeScanSinglePredicate(high_value, high_comparison_type);
+	// Equality predicates on a prefix of the key columns.
+	return std::move(result);
 }
 
 //===--------------------------------------------------------------------===//
@@ -424,7 +519,7 @@ bool ART::ConstructInternal(const unsafe_vector<ARTKey> &keys, const unsafe_vect
 		}
 
 		reference<Node> ref(node);
-		auto count = UnsafeNumericCast<uint8_t>(start.len - prefix_depth);
+		auto count = start.len - prefix_depth;
 		Prefix::New(*this, ref, start, prefix_depth, count);
 		if (row_id_count == 1) {
 			Leaf::New(ref, row_ids[section.start].GetRowId());
@@ -895,15 +990,119 @@ bool ART::SearchCloseRange(ARTKey &lower_bound, ARTKey &upper_bound, bool left_e
 	return it.Scan(upper_bound, max_count, row_ids, right_equal);
 }
 
+//! Returns the smallest key greater than all keys starting with the bytes of key.
+//! Returns an empty key, if no such key exists.
+static ARTKey IncrementKey(ArenaAllocator &arena_allocator, const ARTKey &key) {
+	auto len = key.len;
+	while (len > 0 && key.data[len - 1] == NumericLimits<uint8_t>::Maximum()) {
+		len--;
+	}
+	if (len == 0) {
+		return ARTKey();
+	}
+	ARTKey result(arena_allocator, len);
+	memcpy(result.data, key.data, len);
+	result.data[len - 1]++;
+	return result;
+}
+
+bool ART::SearchKeyRange(ARTIndexScanState &state, idx_t max_count, unsafe_vector<row_t> &row_ids) {
+	ArenaAllocator arena_allocator(Allocator::Get(db));
+
+	// Concatenate the keys of the equality predicates on the leading key columns.
+	ARTKey prefix_key;
+	for (idx_t i = 0; i < state.prefix_values.size(); i++) {
+		D_ASSERT(state.prefix_values[i].type().InternalType() == types[i]);
+		auto key = ARTKey::CreateKey(arena_allocator, types[i], state.prefix_values[i]);
+		if (i == 0) {
+			prefix_key = key;
+		} else {
+			prefix_key.Concat(arena_allocator, key);
+		}
+	}
+
+	// By default, we scan all keys starting with the prefix key.
+	// An empty lower bound starts at the minimum, and an empty upper bound scans to the maximum.
+	auto column_idx = state.prefix_values.size();
+	auto lower_bound = prefix_key;
+	auto upper_bound = IncrementKey(arena_allocator, prefix_key);
+
+	for (idx_t i = 0; i < 2; i++) {
+		if (state.values[i].IsNull()) {
+			continue;
+		}
+		D_ASSERT(state.values[i].type().InternalType() == types[column_idx]);
+		auto key = ARTKey::CreateKey(arena_allocator, types[column_idx], state.values[i]);
+		if (state.is_string_prefix) {
+			// We remove the null-terminator, so that the key matches all strings starting with the prefix.
+			key.len--;
+		}
+		auto bound = prefix_key;
+		if (bound.Empty()) {
+			bound = key;
+		} else {
+			bound.Concat(arena_allocator, key);
+		}
+
+		if (state.is_string_prefix) {
+			lower_bound = bound;
+			upper_bound = IncrementKey(arena_allocator, bound);
+			continue;
+		}
+
+		switch (state.expressions[i]) {
+		case ExpressionType::COMPARE_EQUAL: {
+			if (column_idx + 1 == types.size()) {
+				return SearchEqual(bound, max_count, row_ids);
+			}
+			lower_bound = bound;
+			upper_bound = IncrementKey(arena_allocator, bound);
+			break;
+		}
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			lower_bound = bound;
+			break;
+		case ExpressionType::COMPARE_GREATERTHAN:
+			lower_bound = IncrementKey(arena_allocator, bound);
+			if (lower_bound.Empty()) {
+				// No key is greater than the lower bound.
+				return true;
+			}
+			break;
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			upper_bound = IncrementKey(arena_allocator, bound);
+			break;
+		case ExpressionType::COMPARE_LESSTHAN:
+			upper_bound = bound;
+			break;
+		default:
+			throw InternalException("Index scan type not implemented");
+		}
+	}
+
+	return SearchCloseRange(lower_bound, upper_bound, true, false, max_count, row_ids);
+}
+
 bool ART::Scan(IndexScanState &state, const idx_t max_count, unsafe_vector<row_t> &row_ids) {
+	// Scans do not modify the index, so they only need a shared lock.
+	auto index_lock = lock.GetSharedLock();
+	LookupScope lookup_scope(*this);
 	auto &scan_state = state.Cast<ARTIndexScanState>();
+	return ScanInternal(scan_state, max_count, row_ids);
+}
+
+bool ART::ScanInternal(ARTIndexScanState &scan_state, const idx_t max_count, unsafe_vector<row_t> &row_ids) {
+	if (types.size() > 1 || scan_state.is_string_prefix) {
+		// Compound keys and string prefixes scan a range of (partial) keys.
+		return SearchKeyRange(scan_state, max_count, row_ids);
+	}
+
 	D_ASSERT(scan_state.values[0].type().InternalType() == types[0]);
 	ArenaAllocator arena_allocator(Allocator::Get(db));
 	auto key = ARTKey::CreateKey(arena_allocator, types[0], scan_state.values[0]);
 
 	if (scan_state.values[1].IsNull()) {
 		// Single predicate.
-		lock_guard<mutex> l(lock);
 		switch (scan_state.expressions[0]) {
 		case ExpressionType::COMPARE_EQUAL:
 			return SearchEqual(key, max_count, row_ids);
@@ -921,7 +1120,6 @@ bool ART::Scan(IndexScanState &state, const idx_t max_count, unsafe_vector<row_t
 	}
 
 	// Two predicates.
-	lock_guard<mutex> l(lock);
 	D_ASSERT(scan_state.values[1].type().InternalType() == types[0]);
 	auto upper_bound = ARTKey::CreateKey(arena_allocator, types[0], scan_state.values[1]);
 	bool left_equal = scan_state.expressions[0] == ExpressionType ::COMPARE_GREATERTHANOREQUALTO;
@@ -976,8 +1174,9 @@ string ART::GenerateConstraintErrorMessage(VerifyExistenceType verify_type, cons
 }
 
 void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_manager) {
-	// Lock the index during constraint checking.
-	lock_guard<mutex> l(lock);
+	// Constraint checking only performs lookups, so concurrent checks can share the lock.
+	auto index_lock = lock.GetSharedLock();
+	auto lookup_scope = make_uniq<LookupScope>(*this);
 
 	DataChunk expr_chunk;
 	expr_chunk.Initialize(Allocator::DefaultAllocator(), logical_types);
@@ -1012,6 +1211,7 @@ void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_m
 		}
 	}
 
+	lookup_scope.reset();
 	conflict_manager.FinishLookup();
 	if (found_conflict == DConstants::INVALID_INDEX) {
 		return;
@@ -1058,6 +1258,9 @@ void ART::TransformToDeprecated() {
 }
 
 IndexStorageInfo ART::GetStorageInfo(const case_insensitive_map_t<Value> &options, const bool to_wal) {
+	// Serialization can transform the leaves and unload the buffers, so we exclude concurrent lookups.
+	auto index_lock = lock.GetExclusiveLock();
+
 	// If the storage format uses deprecated leaf storage,
 	// then we need to transform all nested leaves before serialization.
 	auto v1_0_0_option = options.find("v1_0_0_storage");
@@ -1175,6 +1378,48 @@ idx_t ART::GetInMemorySize(IndexLock &index_lock) {
 	return in_memory_size;
 }
 
+ART::LookupScope::LookupScope(ART &art) : art(art) {
+	while (art.active_lookups.fetch_add(1) & RELEASING_PINS) {
+		// The last lookup is releasing the pins, wait until it is done.
+		art.active_lookups--;
+		lock_guard<mutex> guard(art.release_lock);
+	}
+}
+
+ART::LookupScope::~LookupScope() {
+	if (art.active_lookups.fetch_sub(1) != 1) {
+		return;
+	}
+	// This was the last active lookup, so we release the pins, unless a new lookup started in the meantime.
+	lock_guard<mutex> guard(art.release_lock);
+	idx_t expected = 0;
+	if (!art.active_lookups.compare_exchange_strong(expected, RELEASING_PINS)) {
+		return;
+	}
+	for (auto &allocator : *art.allocators) {
+		allocator->ReleasePins();
+	}
+	art.active_lookups -= RELEASING_PINS;
+}
+
+vector<ARTNodeMemoryInfo> ART::GetNodeMemoryInfo(IndexLock &index_lock) {
+	const NType node_types[] = {NType::PREFIX,      NType::LEAF,         NType::NODE_4,
+	                            NType::NODE_16,     NType::NODE_48,      NType::NODE_256,
+	                            NType::NODE_7_LEAF, NType::NODE_15_LEAF, NType::NODE_256_LEAF};
+
+	vector<ARTNodeMemoryInfo> node_infos;
+	for (const auto type : node_types) {
+		auto &allocator = Node::GetAllocator(*this, type);
+		ARTNodeMemoryInfo node_info;
+		node_info.type = type;
+		node_info.segment_size = allocator.GetSegmentSize();
+		node_info.segment_count = allocator.GetSegmentCount();
+		node_info.in_memory_size = allocator.GetInMemorySize();
+		node_infos.push_back(node_info);
+	}
+	return node_infos;
+}
+
 //===--------------------------------------------------------------------===//
 // Vacuum
 //===--------------------------------------------------------------------===//
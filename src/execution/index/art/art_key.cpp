@@ -6,7 +6,7 @@ namespace duckdb {
 // ARTKey
 //===--------------------------------------------------------------------===//
 
-ARTKey::ARTKey() : len(0) {
+ARTKey::ARTKey() : len(0), data(nullptr) {
 }
 
 ARTKey::ARTKey(const data_ptr_t data, idx_t len) : len(len), data(data) {
@@ -15,10 +15,7 @@ namespace duckdb {
 template <uint8_t CAPACITY, NType TYPE>
 void BaseLeaf<CAPACITY, TYPE>::InsertByteInternal(BaseLeaf &n, const uint8_t byte) {
 	// Still space. Insert the child.
-	uint8_t child_pos = 0;
-	while (child_pos < n.count && n.key[child_pos] < byte) {
-		child_pos++;
-	}
+	auto child_pos = n.LowerBound(byte);
 
 	// Move children backwards to make space.
 	for (uint8_t i = n.count; i > child_pos; i--) {
@@ -159,6 +159,13 @@ bool Iterator::LowerBound(const Node &node, const ARTKey &key, const bool equal,
 		return true;
 	}
 
+	// The key is a prefix of all keys in this subtree, e.g., for range scans over
+	// the leading columns of a compound key. Thus, the minimum is the lower bound.
+	if (depth == key.len) {
+		FindMinimum(node);
+		return true;
+	}
+
 	D_ASSERT(node.GetGateStatus() == GateStatus::GATE_NOT_SET);
 	if (node.GetType() != NType::PREFIX) {
 		auto next_byte = key[depth];
@@ -191,6 +198,12 @@ bool Iterator::LowerBound(const Node &node, const ARTKey &key, const bool equal,
 
 	// We compare the prefix bytes with the key bytes.
 	for (idx_t i = 0; i < prefix.data[Prefix::Count(art)]; i++) {
+		// The remaining key bytes match the prefix. Thus, the minimum is the lower bound.
+		if (depth + i == key.len) {
+			FindMinimum(*prefix.ptr);
+			return true;
+		}
+
 		// We found a prefix byte that is less than its corresponding key byte.
 		// I.e., the subsequent node is lesser than the key. Thus, the next node
 		// is the lower bound.
@@ -197,19 +197,19 @@ void Node::DeleteChild(ART &art, Node &node, Node &prefix, const uint8_t byte, c
 //===--------------------------------------------------------------------===//
 
 template <class NODE>
-unsafe_optional_ptr<Node> GetChildInternal(ART &art, NODE &node, const uint8_t byte) {
+unsafe_optional_ptr<Node> GetChildInternal(ART &art, NODE &node, const uint8_t byte, const bool is_mutable) {
 	D_ASSERT(node.HasMetadata());
 
 	auto type = node.GetType();
 	switch (type) {
 	case NType::NODE_4:
-		return Node4::GetChild(Node::Ref<Node4>(art, node, type), byte);
+		return Node4::GetChild(Node::Ref<Node4>(art, node, type, is_mutable), byte);
 	case NType::NODE_16:
-		return Node16::GetChild(Node::Ref<Node16>(art, node, type), byte);
+		return Node16::GetChild(Node::Ref<Node16>(art, node, type, is_mutable), byte);
 	case NType::NODE_48:
-		return Node48::GetChild(Node::Ref<Node48>(art, node, type), byte);
+		return Node48::GetChild(Node::Ref<Node48>(art, node, type, is_mutable), byte);
 	case NType::NODE_256: {
-		return Node256::GetChild(Node::Ref<Node256>(art, node, type), byte);
+		return Node256::GetChild(Node::Ref<Node256>(art, node, type, is_mutable), byte);
 	}
 	default:
 		throw InternalException("Invalid node type for GetChildInternal: %d.", static_cast<uint8_t>(type));
@@ -217,38 +217,38 @@ unsafe_optional_ptr<Node> GetChildInternal(ART &art, NODE &node, const uint8_t b
 }
 
 const unsafe_optional_ptr<Node> Node::GetChild(ART &art, const uint8_t byte) const {
-	return GetChildInternal(art, *this, byte);
+	return GetChildInternal(art, *this, byte, false);
 }
 
 unsafe_optional_ptr<Node> Node::GetChildMutable(ART &art, const uint8_t byte) const {
-	return GetChildInternal(art, *this, byte);
+	return GetChildInternal(art, *this, byte, true);
 }
 
 template <class NODE>
-unsafe_optional_ptr<Node> GetNextChildInternal(ART &art, NODE &node, uint8_t &byte) {
+unsafe_optional_ptr<Node> GetNextChildInternal(ART &art, NODE &node, uint8_t &byte, const bool is_mutable) {
 	D_ASSERT(node.HasMetadata());
 
 	auto type = node.GetType();
 	switch (type) {
 	case NType::NODE_4:
-		return Node4::GetNextChild(Node::Ref<Node4>(art, node, type), byte);
+		return Node4::GetNextChild(Node::Ref<Node4>(art, node, type, is_mutable), byte);
 	case NType::NODE_16:
-		return Node16::GetNextChild(Node::Ref<Node16>(art, node, type), byte);
+		return Node16::GetNextChild(Node::Ref<Node16>(art, node, type, is_mutable), byte);
 	case NType::NODE_48:
-		return Node48::GetNextChild(Node::Ref<Node48>(art, node, type), byte);
+		return Node48::GetNextChild(Node::Ref<Node48>(art, node, type, is_mutable), byte);
 	case NType::NODE_256:
-		return Node256::GetNextChild(Node::Ref<Node256>(art, node, type), byte);
+		return Node256::GetNextChild(Node::Ref<Node256>(art, node, type, is_mutable), byte);
 	default:
 		throw InternalException("Invalid node type for GetNextChildInternal: %d.", static_cast<uint8_t>(type));
 	}
 }
 
 const unsafe_optional_ptr<Node> Node::GetNextChild(ART &art, uint8_t &byte) const {
-	return GetNextChildInternal(art, *this, byte);
+	return GetNextChildInternal(art, *this, byte, false);
 }
 
 unsafe_optional_ptr<Node> Node::GetNextChildMutable(ART &art, uint8_t &byte) const {
-	return GetNextChildInternal(art, *this, byte);
+	return GetNextChildInternal(art, *this, byte, true);
 }
 
 bool Node::HasByte(ART &art, uint8_t &byte) const {
@@ -261,7 +261,7 @@ bool Node::HasByte(ART &art, uint8_t &byte) const {
 	case NType::NODE_15_LEAF:
 		return Ref<const Node15Leaf>(art, *this, NType::NODE_15_LEAF).HasByte(byte);
 	case NType::NODE_256_LEAF:
-		return Ref<Node256Leaf>(art, *this, NType::NODE_256_LEAF).HasByte(byte);
+		return Ref<Node256Leaf>(art, *this, NType::NODE_256_LEAF, false).HasByte(byte);
 	default:
 		throw InternalException("Invalid node type for GetNextByte: %d.", static_cast<uint8_t>(type));
 	}
@@ -277,7 +277,7 @@ bool Node::GetNextByte(ART &art, uint8_t &byte) const {
 	case NType::NODE_15_LEAF:
 		return Ref<const Node15Leaf>(art, *this, NType::NODE_15_LEAF).GetNextByte(byte);
 	case NType::NODE_256_LEAF:
-		return Ref<Node256Leaf>(art, *this, NType::NODE_256_LEAF).GetNextByte(byte);
+		return Ref<Node256Leaf>(art, *this, NType::NODE_256_LEAF, false).GetNextByte(byte);
 	default:
 		throw InternalException("Invalid node type for GetNextByte: %d.", static_cast<uint8_t>(type));
 	}
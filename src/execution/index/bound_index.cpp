@@ -24,12 +24,11 @@ BoundIndex::BoundIndex(const string &name, const string &index_type, IndexConstr
 		logical_types.push_back(expr->return_type);
 		unbound_expressions.emplace_back(expr->Copy());
 		bound_expressions.push_back(BindExpression(expr->Copy()));
-		executor.AddExpression(*bound_expressions.back());
 	}
 }
 
 void BoundIndex::InitializeLock(IndexLock &state) {
-	state.index_lock = unique_lock<mutex>(lock);
+	state.index_lock = lock.GetExclusiveLock();
 }
 
 ErrorData BoundIndex::Append(DataChunk &entries, Vector &row_identifiers) {
@@ -81,6 +80,21 @@ idx_t BoundIndex::GetInMemorySize() {
 }
 
 void BoundIndex::ExecuteExpressions(DataChunk &input, DataChunk &result) {
+	bool all_references = true;
+	for (auto &expr : bound_expressions) {
+		all_references = all_references && expr->type == ExpressionType::BOUND_REF;
+	}
+	if (all_references) {
+		// Index keys on plain columns do not need an executor, we reference the input columns directly
+		for (idx_t i = 0; i < bound_expressions.size(); i++) {
+			auto &ref = bound_expressions[i]->Cast<BoundReferenceExpression>();
+			result.data[i].Reference(input.data[ref.index]);
+		}
+		result.SetCardinality(input.size());
+		return;
+	}
+	// Concurrent lookups and constraint checks can execute the index expressions, so each call has its own executor
+	ExpressionExecutor executor(bound_expressions);
 	executor.Execute(input, result);
 }
 
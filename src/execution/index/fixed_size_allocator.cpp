@@ -119,9 +119,21 @@ void FixedSizeAllocator::Reset() {
 	}
 	buffers.clear();
 	buffers_with_free_space.clear();
+	pinned_buffers.clear();
 	total_segment_count = 0;
 }
 
+void FixedSizeAllocator::ReleasePins() {
+	lock_guard<mutex> guard(load_lock);
+	for (auto &buffer_id : pinned_buffers) {
+		auto buffer_it = buffers.find(buffer_id);
+		if (buffer_it != buffers.end()) {
+			buffer_it->second.Unpin();
+		}
+	}
+	pinned_buffers.clear();
+}
+
 idx_t FixedSizeAllocator::GetInMemorySize() const {
 	idx_t memory_usage = 0;
 	for (auto &buffer : buffers) {
@@ -335,6 +347,21 @@ void FixedSizeAllocator::Deserialize(MetadataManager &metadata_manager, const Bl
 	}
 }
 
+void FixedSizeAllocator::LoadBuffer(FixedSizeBuffer &buffer) {
+	lock_guard<mutex> guard(load_lock);
+	if (!buffer.InMemory()) {
+		buffer.Pin();
+	}
+}
+
+void FixedSizeAllocator::PinBuffer(const idx_t buffer_id, FixedSizeBuffer &buffer) {
+	lock_guard<mutex> guard(load_lock);
+	if (!buffer.Readable()) {
+		buffer.PinOnDisk();
+		pinned_buffers.push_back(buffer_id);
+	}
+}
+
 idx_t FixedSizeAllocator::GetAvailableBufferId() const {
 	idx_t buffer_id = buffers.size();
 	while (buffers.find(buffer_id) != buffers.end()) {
@@ -37,27 +37,39 @@ constexpr uint8_t FixedSizeBuffer::SHIFT[];
 
 FixedSizeBuffer::FixedSizeBuffer(BlockManager &block_manager)
     : block_manager(block_manager), segment_count(0), allocation_size(0), dirty(false), vacuum(false), block_pointer(),
-      block_handle(nullptr) {
+      block_handle(nullptr), in_memory(false), pinned(false) {
 
 	auto &buffer_manager = block_manager.buffer_manager;
 	buffer_handle = buffer_manager.Allocate(MemoryTag::ART_INDEX, block_manager.GetBlockSize(), false);
 	block_handle = buffer_handle.GetBlockHandle();
+	in_memory = true;
 }
 
 FixedSizeBuffer::FixedSizeBuffer(BlockManager &block_manager, const idx_t segment_count, const idx_t allocation_size,
                                  const BlockPointer &block_pointer)
     : block_manager(block_manager), segment_count(segment_count), allocation_size(allocation_size), dirty(false),
-      vacuum(false), block_pointer(block_pointer) {
+      vacuum(false), block_pointer(block_pointer), in_memory(false), pinned(false) {
 
 	D_ASSERT(block_pointer.IsValid());
 	block_handle = block_manager.RegisterBlock(block_pointer.block_id);
 	D_ASSERT(block_handle->BlockId() < MAXIMUM_BLOCK);
 }
 
+FixedSizeBuffer::FixedSizeBuffer(FixedSizeBuffer &&other) noexcept
+    : block_manager(other.block_manager), segment_count(other.segment_count), allocation_size(other.allocation_size),
+      dirty(other.dirty), vacuum(other.vacuum), block_pointer(other.block_pointer),
+      buffer_handle(std::move(other.buffer_handle)), block_handle(std::move(other.block_handle)),
+      in_memory(other.in_memory.load()), pinned_handle(std::move(other.pinned_handle)), pinned(other.pinned.load()) {
+	other.in_memory = false;
+	other.pinned = false;
+}
+
 void FixedSizeBuffer::Destroy() {
+	Unpin();
 	if (InMemory()) {
 		// we can have multiple readers on a pinned block, and unpinning the buffer handle
 		// decrements the reader count on the underlying block handle (Destroy() unpins)
+		in_memory = false;
 		buffer_handle.Destroy();
 	}
 	if (OnDisk()) {
@@ -69,6 +81,9 @@ void FixedSizeBuffer::Destroy() {
 void FixedSizeBuffer::Serialize(PartialBlockManager &partial_block_manager, const idx_t available_segments,
                                 const idx_t segment_size, const idx_t bitmask_offset) {
 
+	// Lookups release their pins before the index can be serialized.
+	D_ASSERT(!pinned);
+
 	// Early-out, if the block is already on disk and not in memory.
 	if (!InMemory()) {
 		if (!OnDisk() || dirty) {
@@ -120,6 +135,7 @@ void FixedSizeBuffer::Serialize(PartialBlockManager &partial_block_manager, cons
 	partial_block_manager.RegisterPartialBlock(std::move(allocation));
 
 	// resetting this buffer
+	in_memory = false;
 	buffer_handle.Destroy();
 	block_handle = block_manager.RegisterBlock(block_pointer.block_id);
 	D_ASSERT(block_handle->BlockId() < MAXIMUM_BLOCK);
@@ -144,6 +160,26 @@ void FixedSizeBuffer::Pin() {
 
 	buffer_handle = std::move(new_buffer_handle);
 	block_handle = std::move(new_block_handle);
+	in_memory = true;
+}
+
+void FixedSizeBuffer::PinOnDisk() {
+	D_ASSERT(!InMemory() && !pinned);
+	D_ASSERT(block_pointer.IsValid());
+	D_ASSERT(block_handle && block_handle->BlockId() < MAXIMUM_BLOCK);
+
+	auto &buffer_manager = block_manager.buffer_manager;
+	pinned_handle = buffer_manager.Pin(block_handle);
+	pinned = true;
+}
+
+void FixedSizeBuffer::Unpin() {
+	if (!pinned) {
+		return;
+	}
+	// The block is persistent, so the buffer manager can evict it without writing it.
+	pinned = false;
+	pinned_handle.Destroy();
 }
 
 uint32_t FixedSizeBuffer::GetOffset(const idx_t bitmask_count) {
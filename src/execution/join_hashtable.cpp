@@ -550,6 +550,29 @@ static inline void InsertMatchesAndIncrementMisses(atomic<ht_entry_t> entries[],
 	}
 }
 
+//! Inserts rows with unique keys into the HT: there are no other rows with the same key to chain them to, so every
+//! row is inserted into the next free entry using linear probing, without comparing any keys
+template <bool PARALLEL>
+static inline void InsertUniqueRows(atomic<ht_entry_t> entries[], const data_ptr_t lhs_row_locations[],
+                                    idx_t ht_offsets_and_salts[], const SelectionVector &sel, const idx_t count,
+                                    const idx_t capacity_mask, const idx_t pointer_offset) {
+	for (idx_t i = 0; i < count; i++) {
+		const auto row_index = sel.get_index(i);
+		idx_t &ht_offset_and_salt = ht_offsets_and_salts[row_index];
+		const hash_t salt = ht_entry_t::ExtractSalt(ht_offset_and_salt);
+		const auto row_ptr_to_insert = lhs_row_locations[row_index];
+		while (true) {
+			auto &atomic_entry = entries[ht_offset_and_salt & ht_entry_t::POINTER_MASK];
+			// if the entry was occupied in the meantime (parallel only), we move on to the next entry
+			if (!atomic_entry.load(std::memory_order_relaxed).IsOccupied() &&
+			    !InsertRowToEntry<PARALLEL, true>(atomic_entry, row_ptr_to_insert, salt, pointer_offset)) {
+				break;
+			}
+			IncrementAndWrap(ht_offset_and_salt, capacity_mask);
+		}
+	}
+}
+
 template <bool PARALLEL>
 static void InsertHashesLoop(atomic<ht_entry_t> entries[], Vector &row_locations, Vector &hashes_v, const idx_t &count,
                              JoinHashTable::InsertState &state, const TupleDataCollection &data_collection,
@@ -595,6 +618,12 @@ static void InsertHashesLoop(atomic<ht_entry_t> entries[], Vector &row_locations
 
 	// use the ht bitmask to make the modulo operation faster but keep the salt bits intact
 	idx_t capacity_mask = ht.bitmask | ht_entry_t::SALT_MASK;
+	if (ht.build_keys_unique) {
+		InsertUniqueRows<PARALLEL>(entries, lhs_row_locations, ht_offsets_and_salts, *remaining_sel, remaining_count,
+		                           capacity_mask, ht.pointer_offset);
+		return;
+	}
+
 	while (remaining_count > 0) {
 		idx_t salt_match_count = 0;
 
@@ -680,7 +709,12 @@ void JoinHashTable::InsertHashes(Vector &hashes_v, const idx_t count, TupleDataC
 }
 
 void JoinHashTable::InitializePointerTable() {
-	capacity = PointerTableCapacity(Count());
+	auto count = Count();
+	if (IsMultiPassBuild()) {
+		// Only the chunks of the current pass are inserted
+		count = MinValue<idx_t>(count, (build_chunk_end - build_chunk_start) * STANDARD_VECTOR_SIZE);
+	}
+	capacity = PointerTableCapacity(count);
 	D_ASSERT(IsPowerOfTwo(capacity));
 
 	if (hash_map.get()) {
@@ -724,6 +758,10 @@ void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool para
 		for (idx_t i = 0; i < count; i++) {
 			hash_data[i] = Load<hash_t>(row_locations[i] + pointer_offset);
 		}
+		if (bloom_filter) {
+			// the hashes are modified in-place by InsertHashes, so we fill the bloom filter first
+			bloom_filter->Insert(hashes, count, parallel);
+		}
 		TupleDataChunkState &chunk_state = iterator.GetChunkState();
 
 		InsertHashes(hashes, count, chunk_state, insert_state, parallel);
@@ -770,7 +808,8 @@ void JoinHashTable::Probe(ScanStructure &scan_structure, DataChunk &keys, TupleD
 }
 
 ScanStructure::ScanStructure(JoinHashTable &ht_p, TupleDataChunkState &key_state_p)
-    : key_state(key_state_p), pointers(LogicalType::POINTER), count(0), sel_vector(STANDARD_VECTOR_SIZE),
+    : key_state(key_state_p), pointers(LogicalType::POINTER), chain_pointers(LogicalType::POINTER), count(0),
+      sel_vector(STANDARD_VECTOR_SIZE),
       chain_match_sel_vector(STANDARD_VECTOR_SIZE), chain_no_match_sel_vector(STANDARD_VECTOR_SIZE),
       found_match(make_unsafe_uniq_array_uninitialized<bool>(STANDARD_VECTOR_SIZE)), ht(ht_p), finished(false),
       is_null(true) {
@@ -906,6 +945,12 @@ void ScanStructure::NextInnerJoin(DataChunk &keys, DataChunk &left, DataChunk &r
 		return;
 	}
 
+	if (!ht.needs_chain_matcher && ht.chains_longer_than_one && ht.join_type != JoinType::RIGHT_SEMI &&
+	    ht.join_type != JoinType::RIGHT_ANTI) {
+		NextInnerJoinChains(left, result);
+		return;
+	}
+
 	idx_t result_count = ScanInnerJoin(keys, chain_match_sel_vector);
 
 	if (result_count > 0) {
@@ -939,6 +984,47 @@ void ScanStructure::NextInnerJoin(DataChunk &keys, DataChunk &left, DataChunk &r
 	}
 }
 
+void ScanStructure::NextInnerJoinChains(DataChunk &left, DataChunk &result) {
+	// Only rows with equal keys are chained, so without non-equality predicates every entry of a chain is a match.
+	// Instead of emitting a single step of the chains per result chunk, which degenerates into tiny chunks when a few
+	// probe tuples hit keys with many duplicates (heavy hitters), we follow the chains until the result chunk is full.
+	// The matches are emitted in the same order as they would be otherwise
+	auto ptrs = FlatVector::GetData<data_ptr_t>(pointers);
+	auto chain_ptrs = FlatVector::GetData<data_ptr_t>(chain_pointers);
+	idx_t result_count = 0;
+	while (this->count > 0 && result_count + this->count <= STANDARD_VECTOR_SIZE) {
+		for (idx_t i = 0; i < this->count; i++) {
+			const auto idx = this->sel_vector.get_index(i);
+			chain_match_sel_vector.set_index(result_count, idx);
+			chain_ptrs[result_count++] = ptrs[idx];
+		}
+		AdvancePointers();
+	}
+	D_ASSERT(result_count > 0);
+
+	if (found_match) {
+		for (idx_t i = 0; i < result_count; i++) {
+			found_match[chain_match_sel_vector.get_index(i)] = true;
+		}
+	}
+	if (PropagatesBuildSide(ht.join_type)) {
+		// full/right outer join: mark join matches as FOUND in the HT
+		for (idx_t i = 0; i < result_count; i++) {
+			Store<bool>(true, chain_ptrs[i] + ht.tuple_size);
+		}
+	}
+
+	// the probe side is sliced with the (repeated) probe indices, the build side is gathered from the chain pointers
+	result.Slice(left, chain_match_sel_vector, result_count);
+	for (idx_t i = 0; i < ht.output_columns.size(); i++) {
+		auto &vector = result.data[left.ColumnCount() + i];
+		const auto output_col_idx = ht.output_columns[i];
+		D_ASSERT(vector.GetType() == ht.layout.GetTypes()[output_col_idx]);
+		ht.data_collection->Gather(chain_pointers, *FlatVector::IncrementalSelectionVector(), result_count,
+		                           output_col_idx, vector, *FlatVector::IncrementalSelectionVector(), nullptr);
+	}
+}
+
 void ScanStructure::ScanKeyMatches(DataChunk &keys) {
 	// the semi-join, anti-join and mark-join we handle a differently from the inner join
 	// since there can be at most STANDARD_VECTOR_SIZE results
@@ -1392,10 +1478,11 @@ void JoinHashTable::Unpartition() {
 }
 
 void JoinHashTable::SetRepartitionRadixBits(const idx_t max_ht_size, const idx_t max_partition_size,
-                                            const idx_t max_partition_count) {
+                                            const idx_t max_partition_count, const idx_t max_radix_bits) {
 	D_ASSERT(max_partition_size + PointerTableSize(max_partition_count) > max_ht_size);
+	D_ASSERT(max_radix_bits > radix_bits && max_radix_bits <= RadixPartitioning::MAX_RADIX_BITS);
 
-	const auto max_added_bits = RadixPartitioning::MAX_RADIX_BITS - radix_bits;
+	const auto max_added_bits = max_radix_bits - radix_bits;
 	idx_t added_bits = 1;
 	for (; added_bits < max_added_bits; added_bits++) {
 		double partition_multiplier = static_cast<double>(RadixPartitioning::NumberOfPartitions(added_bits));
@@ -1442,6 +1529,7 @@ bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
 	// Start where we left off
 	auto &partitions = sink_collection->GetPartitions();
 	partition_start = partition_end;
+	build_chunks_per_pass = DConstants::INVALID_INDEX;
 
 	// Determine how many partitions we can do next (at least one)
 	idx_t count = 0;
@@ -1465,6 +1553,32 @@ bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
 	}
 	D_ASSERT(Count() == count);
 
+	const auto ht_size = data_size + PointerTableSize(count);
+	if (ht_size > max_ht_size && join_type == JoinType::INNER) {
+		// Even a single partition does not fit, e.g., because a few keys are so frequent that repartitioning cannot
+		// split them up. We build the HT in multiple passes over the partition, and probe all of its probe-side data
+		// once per pass. This only works for inner joins, as other join types need to know about matches across passes
+		const auto chunk_count = data_collection->ChunkCount();
+		const auto fraction = static_cast<double>(max_ht_size) / static_cast<double>(ht_size);
+		build_chunks_per_pass = MaxValue<idx_t>(LossyNumericCast<idx_t>(static_cast<double>(chunk_count) * fraction), 1);
+		build_chunk_start = 0;
+		build_chunk_end = MinValue<idx_t>(chunk_count, build_chunks_per_pass);
+	}
+
+	return true;
+}
+
+bool JoinHashTable::PrepareNextBuildPass() {
+	if (!HasNextBuildPass()) {
+		return false;
+	}
+
+	// The rows of the previous pass are no longer needed, unpin them so that they can be evicted
+	data_collection->Unpin();
+	finalized = false;
+
+	build_chunk_start = build_chunk_end;
+	build_chunk_end = MinValue<idx_t>(data_collection->ChunkCount(), build_chunk_start + build_chunks_per_pass);
 	return true;
 }
 
@@ -1500,10 +1614,17 @@ void JoinHashTable::ProbeAndSpill(ScanStructure &scan_structure, DataChunk &keys
 
 	CreateSpillChunk(spill_chunk, keys, payload, hashes);
 
-	// can't probe these values right now, append to spill
-	spill_chunk.Slice(false_sel, false_count);
-	spill_chunk.Verify();
-	probe_spill.Append(spill_chunk, spill_state);
+	if (HasNextBuildPass()) {
+		// the current partitions are built in multiple passes, every pass needs to probe all values
+		spill_chunk.SetCardinality(keys.size());
+		spill_chunk.Verify();
+		probe_spill.Append(spill_chunk, spill_state);
+	} else {
+		// can't probe these values right now, append to spill
+		spill_chunk.Slice(false_sel, false_count);
+		spill_chunk.Verify();
+		probe_spill.Append(spill_chunk, spill_state);
+	}
 
 	// slice the stuff we CAN probe right now
 	hashes.Slice(true_sel, true_count);
@@ -1560,6 +1681,12 @@ void ProbeSpill::Finalize() {
 }
 
 void ProbeSpill::PrepareNextProbe() {
+	if (ht.GetBuildChunkStart() != 0 && global_spill_collection) {
+		// Next pass over the same partitions, we probe the same data again
+		PrepareConsumer();
+		return;
+	}
+
 	auto &partitions = global_partitions->GetPartitions();
 	if (partitions.empty() || ht.partition_start == partitions.size()) {
 		// Can't probe, just make an empty one
@@ -1577,7 +1704,12 @@ void ProbeSpill::PrepareNextProbe() {
 			}
 		}
 	}
-	consumer = make_uniq<ColumnDataConsumer>(*global_spill_collection, column_ids);
+	PrepareConsumer();
+}
+
+void ProbeSpill::PrepareConsumer() {
+	// Only consume the data while scanning if there is no next pass over the same partitions
+	consumer = make_uniq<ColumnDataConsumer>(*global_spill_collection, column_ids, !ht.HasNextBuildPass());
 	consumer->InitializeScan();
 }
 
@@ -1,6 +1,7 @@
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 
 #include "duckdb/common/radix_partitioning.hpp"
+#include "duckdb/common/types/value_map.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/execution/operator/aggregate/ungrouped_aggregate_state.hpp"
 #include "duckdb/function/aggregate/distributive_functions.hpp"
@@ -14,7 +15,9 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
@@ -115,7 +118,8 @@ public:
 	    : context(context_p), op(op_p),
 	      num_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
 	      temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context)), finalized(false),
-	      active_local_states(0), total_size(0), max_partition_size(0), max_partition_count(0), scanned_data(false) {
+	      active_local_states(0), total_size(0), max_partition_size(0), max_partition_count(0),
+	      probe_side_requirement(0), scanned_data(false) {
 		hash_table = op.InitializeHashTable(context);
 
 		// For perfect hash join
@@ -135,6 +139,12 @@ public:
 
 	void ScheduleFinalize(Pipeline &pipeline, Event &event);
 	void InitializeProbeSpill();
+	//! Sets the minimum reservation for building the external partitions and partitioning the probe side
+	void SetExternalMinimumReservation(idx_t probe_side_requirement_p);
+	//! The maximum size of the HT when building the next external partitions
+	idx_t GetMaxExternalHTSize() const;
+	//! The maximum size of a HT that can be pinned while partitioning the probe side
+	idx_t GetMaxPinnableHTSize() const;
 
 public:
 	ClientContext &context;
@@ -158,6 +168,8 @@ public:
 	idx_t total_size;
 	idx_t max_partition_size;
 	idx_t max_partition_count;
+	//! The space required for partitioning the probe side (external only)
+	idx_t probe_side_requirement;
 
 	//! Hash tables built by each thread
 	vector<unique_ptr<JoinHashTable>> local_hash_tables;
@@ -219,6 +231,7 @@ public:
 
 unique_ptr<JoinHashTable> PhysicalHashJoin::InitializeHashTable(ClientContext &context) const {
 	auto result = make_uniq<JoinHashTable>(context, conditions, payload_types, join_type, rhs_output_columns);
+	result->build_keys_unique = build_keys_unique;
 	if (!delim_types.empty() && join_type == JoinType::MARK) {
 		// correlated MARK join
 		if (delim_types.size() + 1 == conditions.size()) {
@@ -373,6 +386,23 @@ static idx_t GetPartitioningSpaceRequirement(ClientContext &context, const vecto
 	return num_threads * num_partitions * size_per_partition;
 }
 
+static idx_t GetMaxRepartitionRadixBits(ClientContext &context, const PhysicalHashJoin &op, const idx_t num_threads) {
+	if (op.join_type != JoinType::INNER) {
+		// Other join types have to build a partition in one pass, so we repartition as much as needed
+		return RadixPartitioning::MAX_RADIX_BITS;
+	}
+	// The probe side is partitioned with the same radix bits, which needs memory for every partition and thread
+	// Inner joins build partitions that are still too large in multiple passes, so we stop before it gets too costly
+	const auto max_memory = BufferManager::GetBufferManager(context).GetQueryMaxMemory();
+	idx_t radix_bits = JoinHashTable::INITIAL_RADIX_BITS;
+	while (radix_bits < RadixPartitioning::MAX_RADIX_BITS &&
+	       GetPartitioningSpaceRequirement(context, op.children[0]->types, radix_bits + 1, num_threads) <=
+	           max_memory / 2) {
+		radix_bits++;
+	}
+	return radix_bits;
+}
+
 void PhysicalHashJoin::PrepareFinalize(ClientContext &context, GlobalSinkState &global_state) const {
 	auto &gstate = global_state.Cast<HashJoinGlobalSinkState>();
 	auto &ht = *gstate.hash_table;
@@ -418,24 +448,25 @@ public:
 
 		vector<shared_ptr<Task>> finalize_tasks;
 		auto &ht = *sink.hash_table;
-		const auto chunk_count = ht.GetDataCollection().ChunkCount();
+		const auto chunk_start = ht.GetBuildChunkStart();
+		const auto chunk_end = ht.GetBuildChunkEnd();
 		const auto num_threads = NumericCast<idx_t>(sink.num_threads);
 		if (num_threads == 1 || (ht.Count() < PARALLEL_CONSTRUCT_THRESHOLD && !context.config.verify_parallelism)) {
 			// Single-threaded finalize
-			finalize_tasks.push_back(
-			    make_uniq<HashJoinFinalizeTask>(shared_from_this(), context, sink, 0U, chunk_count, false, sink.op));
+			finalize_tasks.push_back(make_uniq<HashJoinFinalizeTask>(shared_from_this(), context, sink, chunk_start,
+			                                                         chunk_end, false, sink.op));
 		} else {
 			// Parallel finalize
-			auto chunks_per_thread = MaxValue<idx_t>((chunk_count + num_threads - 1) / num_threads, 1);
+			auto chunks_per_thread = MaxValue<idx_t>((chunk_end - chunk_start + num_threads - 1) / num_threads, 1);
 
-			idx_t chunk_idx = 0;
+			idx_t chunk_idx = chunk_start;
 			for (idx_t thread_idx = 0; thread_idx < num_threads; thread_idx++) {
 				auto chunk_idx_from = chunk_idx;
-				auto chunk_idx_to = MinValue<idx_t>(chunk_idx_from + chunks_per_thread, chunk_count);
+				auto chunk_idx_to = MinValue<idx_t>(chunk_idx_from + chunks_per_thread, chunk_end);
 				finalize_tasks.push_back(make_uniq<HashJoinFinalizeTask>(shared_from_this(), context, sink,
 				                                                         chunk_idx_from, chunk_idx_to, true, sink.op));
 				chunk_idx = chunk_idx_to;
-				if (chunk_idx == chunk_count) {
+				if (chunk_idx == chunk_end) {
 					break;
 				}
 			}
@@ -444,8 +475,14 @@ public:
 	}
 
 	void FinishEvent() override {
-		sink.hash_table->GetDataCollection().VerifyEverythingPinned();
+		if (!sink.hash_table->IsMultiPassBuild()) {
+			sink.hash_table->GetDataCollection().VerifyEverythingPinned();
+		}
 		sink.hash_table->finalized = true;
+		if (sink.hash_table->bloom_filter) {
+			// all hashes have been inserted - the bloom filter is complete and can be pushed into the probe side
+			sink.op.filter_pushdown->PushBloomFilter(sink.op, std::move(sink.hash_table->bloom_filter));
+		}
 	}
 
 	static constexpr const idx_t PARALLEL_CONSTRUCT_THRESHOLD = 1048576;
@@ -468,6 +505,38 @@ void HashJoinGlobalSinkState::InitializeProbeSpill() {
 	}
 }
 
+idx_t HashJoinGlobalSinkState::GetMaxPinnableHTSize() const {
+	// Whatever is not needed for partitioning the probe side, but at least a quarter of the memory
+	const auto max_memory = BufferManager::GetBufferManager(context).GetQueryMaxMemory();
+	const auto available_memory = max_memory > probe_side_requirement ? max_memory - probe_side_requirement : 0;
+	return MaxValue<idx_t>(available_memory, max_memory / 4);
+}
+
+void HashJoinGlobalSinkState::SetExternalMinimumReservation(const idx_t probe_side_requirement_p) {
+	probe_side_requirement = probe_side_requirement_p;
+	auto max_partition_ht_size = max_partition_size + JoinHashTable::PointerTableSize(max_partition_count);
+	if (op.join_type == JoinType::INNER) {
+		// Inner joins build a partition that cannot be pinned (e.g., due to a hot key) in multiple passes
+		// Reserving memory for the whole partition would only make other operators spill
+		max_partition_ht_size = MinValue(max_partition_ht_size, GetMaxPinnableHTSize());
+	}
+	temporary_memory_state->SetMinimumReservation(max_partition_ht_size + probe_side_requirement);
+}
+
+idx_t HashJoinGlobalSinkState::GetMaxExternalHTSize() const {
+	const auto reservation = temporary_memory_state->GetReservation();
+	if (op.join_type != JoinType::INNER) {
+		return reservation;
+	}
+	const auto max_pinnable_ht_size = GetMaxPinnableHTSize();
+	if (max_partition_size + JoinHashTable::PointerTableSize(max_partition_count) <= max_pinnable_ht_size) {
+		// All partitions can be pinned, no need to limit the HT
+		return reservation;
+	}
+	// The largest partition is built in multiple passes, which must not exceed what can actually be pinned
+	return MinValue<idx_t>(reservation, max_pinnable_ht_size);
+}
+
 class HashJoinRepartitionTask : public ExecutorTask {
 public:
 	HashJoinRepartitionTask(shared_ptr<Event> event_p, ClientContext &context, JoinHashTable &global_ht,
@@ -550,17 +619,63 @@ public:
 		const auto probe_side_requirement =
 		    GetPartitioningSpaceRequirement(sink.context, op.types, sink.hash_table->GetRadixBits(), sink.num_threads);
 
-		sink.temporary_memory_state->SetMinimumReservation(sink.max_partition_size +
-		                                                   JoinHashTable::PointerTableSize(sink.max_partition_count) +
-		                                                   probe_side_requirement);
+		sink.SetExternalMinimumReservation(probe_side_requirement);
 		sink.temporary_memory_state->UpdateReservation(executor.context);
 
-		sink.hash_table->PrepareExternalFinalize(sink.temporary_memory_state->GetReservation());
+		sink.hash_table->PrepareExternalFinalize(sink.GetMaxExternalHTSize());
 		sink.ScheduleFinalize(*pipeline, *this);
 	}
 };
 
-void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const {
+static vector<vector<Value>> GetDistinctBuildKeys(JoinHashTable &ht, const vector<JoinFilterPushdownColumn> &filters) {
+	// for every filter, collect the distinct non-NULL keys (if there are few enough of them)
+	vector<vector<Value>> result(filters.size());
+	if (ht.Count() > JoinFilterPushdownInfo::IN_FILTER_MAX_BUILD_SIZE) {
+		return result;
+	}
+	vector<column_t> column_ids;
+	vector<value_set_t> distinct_keys;
+	vector<bool> too_many_keys;
+	for (auto &filter : filters) {
+		column_ids.push_back(filter.join_condition);
+		distinct_keys.emplace_back();
+		too_many_keys.push_back(!InFilter::SupportsType(ht.condition_types[filter.join_condition]));
+	}
+	auto &data_collection = ht.GetDataCollection();
+	TupleDataScanState scan_state;
+	data_collection.InitializeScan(scan_state, std::move(column_ids));
+	DataChunk keys;
+	data_collection.InitializeScanChunk(scan_state, keys);
+	while (data_collection.Scan(scan_state, keys)) {
+		for (idx_t col_idx = 0; col_idx < keys.ColumnCount(); col_idx++) {
+			if (too_many_keys[col_idx]) {
+				continue;
+			}
+			auto &column_keys = distinct_keys[col_idx];
+			for (idx_t row_idx = 0; row_idx < keys.size(); row_idx++) {
+				auto key = keys.GetValue(col_idx, row_idx);
+				if (key.IsNull()) {
+					continue;
+				}
+				column_keys.insert(std::move(key));
+				if (column_keys.size() > JoinFilterPushdownInfo::IN_FILTER_MAX_VALUES) {
+					too_many_keys[col_idx] = true;
+					column_keys.clear();
+					break;
+				}
+			}
+		}
+	}
+	for (idx_t filter_idx = 0; filter_idx < filters.size(); filter_idx++) {
+		for (auto &key : distinct_keys[filter_idx]) {
+			result[filter_idx].push_back(key);
+		}
+	}
+	return result;
+}
+
+void JoinFilterPushdownInfo::PushFilters(JoinHashTable &ht, JoinFilterGlobalState &gstate,
+                                         const PhysicalOperator &op) const {
 	// finalize the min/max aggregates
 	vector<LogicalType> min_max_types;
 	for (auto &aggr_expr : min_max_aggregates) {
@@ -571,7 +686,12 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 
 	gstate.global_aggregate_state->Finalize(final_min_max);
 
+	// if the build side is small, we can push the actual keys instead of only a range
+	// this allows skipping segments/row groups where the range of the keys spans the whole min/max range
+	auto distinct_keys = GetDistinctBuildKeys(ht, filters);
+
 	// create a filter for each of the aggregates
+	gstate.exact_filters = true;
 	for (idx_t filter_idx = 0; filter_idx < filters.size(); filter_idx++) {
 		auto &filter = filters[filter_idx];
 		auto filter_col_idx = filter.probe_column_index.column_index;
@@ -584,12 +704,17 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 			// min/max is NULL
 			// this can happen in case all values in the RHS column are NULL, but they are still pushed into the hash
 			// table e.g. because they are part of a RIGHT join
+			gstate.exact_filters = false;
 			continue;
 		}
 		if (Value::NotDistinctFrom(min_val, max_val)) {
 			// min = max - generate an equality filter
 			auto constant_filter = make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, std::move(min_val));
 			dynamic_filters->PushFilter(op, filter_col_idx, std::move(constant_filter));
+		} else if (!distinct_keys[filter_idx].empty()) {
+			// few distinct keys - generate an IN filter
+			auto in_filter = make_uniq<InFilter>(std::move(distinct_keys[filter_idx]));
+			dynamic_filters->PushFilter(op, filter_col_idx, std::move(in_filter));
 		} else {
 			// min != max - generate a range filter
 			auto greater_equals =
@@ -597,12 +722,38 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 			dynamic_filters->PushFilter(op, filter_col_idx, std::move(greater_equals));
 			auto less_equals = make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, std::move(max_val));
 			dynamic_filters->PushFilter(op, filter_col_idx, std::move(less_equals));
+			gstate.exact_filters = false;
 		}
 		// not null filter
 		dynamic_filters->PushFilter(op, filter_col_idx, make_uniq<IsNotNullFilter>());
 	}
 }
 
+shared_ptr<BlockedBloomFilter> JoinFilterPushdownInfo::CreateBloomFilter(JoinFilterGlobalState &gstate,
+                                                                         const JoinHashTable &ht) const {
+	if (gstate.exact_filters) {
+		// the pushed filters already exactly match the build side keys
+		return nullptr;
+	}
+	if (filters.size() != 1 || filters[0].join_condition != 0 || ht.equality_types.size() != 1) {
+		// the hashes in the hash table are the combined hashes of all equality conditions
+		// we can only probe them from the scan if there is a single equality condition
+		return nullptr;
+	}
+	if (ht.Count() == 0 || ht.Count() > BLOOM_FILTER_MAX_BUILD_SIZE) {
+		// empty or too large build side - min/max filters are all we push
+		return nullptr;
+	}
+	return make_shared_ptr<BlockedBloomFilter>(ht.Count());
+}
+
+void JoinFilterPushdownInfo::PushBloomFilter(const PhysicalOperator &op,
+                                             shared_ptr<BlockedBloomFilter> bloom_filter) const {
+	D_ASSERT(filters.size() == 1);
+	auto filter_col_idx = filters[0].probe_column_index.column_index;
+	dynamic_filters->PushFilter(op, filter_col_idx, make_uniq<BloomFilter>(std::move(bloom_filter)));
+}
+
 SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                             OperatorSinkFinalizeInput &input) const {
 	auto &sink = input.global_state.Cast<HashJoinGlobalSinkState>();
@@ -616,22 +767,24 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 
 		const auto max_partition_ht_size =
 		    sink.max_partition_size + JoinHashTable::PointerTableSize(sink.max_partition_count);
-		if (max_partition_ht_size > sink.temporary_memory_state->GetReservation()) {
+		const auto max_radix_bits = GetMaxRepartitionRadixBits(context, *this, sink.num_threads);
+		if (max_partition_ht_size > sink.temporary_memory_state->GetReservation() &&
+		    ht.GetRadixBits() < max_radix_bits) {
 			// We have to repartition
 			ht.SetRepartitionRadixBits(sink.temporary_memory_state->GetReservation(), sink.max_partition_size,
-			                           sink.max_partition_count);
+			                           sink.max_partition_count, max_radix_bits);
 			auto new_event = make_shared_ptr<HashJoinRepartitionEvent>(pipeline, *this, sink, sink.local_hash_tables);
 			event.InsertEvent(std::move(new_event));
 		} else {
 			// No repartitioning! We do need some space for partitioning the probe-side, though
 			const auto probe_side_requirement =
 			    GetPartitioningSpaceRequirement(context, children[0]->types, ht.GetRadixBits(), sink.num_threads);
-			sink.temporary_memory_state->SetMinimumReservation(max_partition_ht_size + probe_side_requirement);
+			sink.SetExternalMinimumReservation(probe_side_requirement);
 			for (auto &local_ht : sink.local_hash_tables) {
 				ht.Merge(*local_ht);
 			}
 			sink.local_hash_tables.clear();
-			sink.hash_table->PrepareExternalFinalize(sink.temporary_memory_state->GetReservation());
+			sink.hash_table->PrepareExternalFinalize(sink.GetMaxExternalHTSize());
 			sink.ScheduleFinalize(pipeline, event);
 		}
 		sink.finalized = true;
@@ -646,7 +799,7 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	ht.Unpartition();
 
 	if (filter_pushdown && ht.Count() > 0) {
-		filter_pushdown->PushFilters(*sink.global_filter_state, *this);
+		filter_pushdown->PushFilters(ht, *sink.global_filter_state, *this);
 	}
 
 	// check for possible perfect hash table
@@ -659,6 +812,10 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	// In case of a large build side or duplicates, use regular hash join
 	if (!use_perfect_hash) {
 		sink.perfect_join_executor.reset();
+		if (filter_pushdown) {
+			// we build a bloom filter over the build side while inserting the hashes into the pointer table
+			ht.bloom_filter = filter_pushdown->CreateBloomFilter(*sink.global_filter_state, ht);
+		}
 		sink.ScheduleFinalize(pipeline, event);
 	}
 	sink.finalized = true;
@@ -915,7 +1072,9 @@ bool HashJoinGlobalSourceState::TryPrepareNextStage(HashJoinGlobalSinkState &sin
 	switch (global_stage.load()) {
 	case HashJoinSourceStage::BUILD:
 		if (build_chunk_done == build_chunk_count) {
-			sink.hash_table->GetDataCollection().VerifyEverythingPinned();
+			if (!sink.hash_table->IsMultiPassBuild()) {
+				sink.hash_table->GetDataCollection().VerifyEverythingPinned();
+			}
 			sink.hash_table->finalized = true;
 			PrepareProbe(sink);
 			return true;
@@ -950,8 +1109,8 @@ void HashJoinGlobalSourceState::PrepareBuild(HashJoinGlobalSinkState &sink) {
 	// Update remaining size
 	sink.temporary_memory_state->SetRemainingSizeAndUpdateReservation(sink.context, ht.GetRemainingSize());
 
-	// Try to put the next partitions in the block collection of the HT
-	if (!sink.external || !ht.PrepareExternalFinalize(sink.temporary_memory_state->GetReservation())) {
+	// Try to do the next pass over the current partitions, or put the next partitions in the block collection
+	if (!sink.external || (!ht.PrepareNextBuildPass() && !ht.PrepareExternalFinalize(sink.GetMaxExternalHTSize()))) {
 		global_stage = HashJoinSourceStage::DONE;
 		sink.temporary_memory_state->SetZero();
 		return;
@@ -963,11 +1122,13 @@ void HashJoinGlobalSourceState::PrepareBuild(HashJoinGlobalSinkState &sink) {
 		return;
 	}
 
-	build_chunk_idx = 0;
-	build_chunk_count = data_collection.ChunkCount();
-	build_chunk_done = 0;
+	// If the partitions are built in multiple passes, we only build a range of the chunks
+	build_chunk_idx = ht.GetBuildChunkStart();
+	build_chunk_count = ht.GetBuildChunkEnd();
+	build_chunk_done = build_chunk_idx;
 
-	build_chunks_per_thread = MaxValue<idx_t>((build_chunk_count + sink.num_threads - 1) / sink.num_threads, 1);
+	const auto pass_chunk_count = build_chunk_count - build_chunk_idx;
+	build_chunks_per_thread = MaxValue<idx_t>((pass_chunk_count + sink.num_threads - 1) / sink.num_threads, 1);
 
 	ht.InitializePointerTable();
 
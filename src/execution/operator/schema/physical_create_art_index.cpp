@@ -38,7 +38,8 @@ public:
 
 class CreateARTIndexLocalSinkState : public LocalSinkState {
 public:
-	explicit CreateARTIndexLocalSinkState(ClientContext &context) : arena_allocator(Allocator::Get(context)) {};
+	explicit CreateARTIndexLocalSinkState(ClientContext &context)
+	    : arena_allocator(Allocator::Get(context)), run_allocator(Allocator::Get(context)) {};
 
 	unique_ptr<BoundIndex> local_index;
 	ArenaAllocator arena_allocator;
@@ -49,6 +50,11 @@ public:
 
 	DataChunk row_id_chunk;
 	unsafe_vector<ARTKey> row_ids;
+
+	//! Sorted input: the keys and row IDs of the current run of ascending keys
+	ArenaAllocator run_allocator;
+	unsafe_vector<ARTKey> run_keys;
+	unsafe_vector<ARTKey> run_row_ids;
 };
 
 unique_ptr<GlobalSinkState> PhysicalCreateARTIndex::GetGlobalSinkState(ClientContext &context) const {
@@ -94,17 +100,24 @@ SinkResultType PhysicalCreateARTIndex::SinkUnsorted(OperatorSinkInput &input) co
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
-SinkResultType PhysicalCreateARTIndex::SinkSorted(OperatorSinkInput &input) const {
+static void AppendToRun(ArenaAllocator &allocator, unsafe_vector<ARTKey> &run, const ARTKey &key) {
+	ARTKey run_key(allocator, key.len);
+	memcpy(run_key.data, key.data, key.len);
+	run.push_back(run_key);
+}
 
-	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
+void PhysicalCreateARTIndex::ConstructRun(CreateARTIndexLocalSinkState &l_state) const {
+	if (l_state.run_keys.empty()) {
+		return;
+	}
 	auto &storage = table.GetStorage();
 	auto &l_index = l_state.local_index;
 
-	// Construct an ART for this chunk.
+	// Construct an ART bottom-up from the sorted run.
 	auto art = make_uniq<ART>(info->index_name, l_index->GetConstraintType(), l_index->GetColumnIds(),
 	                          l_index->table_io_manager, l_index->unbound_expressions, storage.db,
 	                          l_index->Cast<ART>().allocators);
-	if (!art->Construct(l_state.keys, l_state.row_ids, l_state.key_chunk.size())) {
+	if (!art->Construct(l_state.run_keys, l_state.run_row_ids, l_state.run_keys.size())) {
 		throw ConstraintException("Data contains duplicates on indexed column(s)");
 	}
 
@@ -113,6 +126,29 @@ SinkResultType PhysicalCreateARTIndex::SinkSorted(OperatorSinkInput &input) cons
 		throw ConstraintException("Data contains duplicates on indexed column(s)");
 	}
 
+	l_state.run_keys.clear();
+	l_state.run_row_ids.clear();
+	l_state.run_allocator.Reset();
+}
+
+SinkResultType PhysicalCreateARTIndex::SinkSorted(OperatorSinkInput &input) const {
+
+	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
+	auto row_count = l_state.key_chunk.size();
+
+	// Each thread receives contiguous ranges of the sorted data, so consecutive chunks usually continue the current
+	// run. We only construct an ART once a key is smaller than the end of the run, or once the run is full.
+	// Construct(...) requires ascending keys, so we compare the ART keys instead of relying on the sort order.
+	// The keys of the chunk are reset with the next chunk, so we copy them into the run.
+	auto &run_keys = l_state.run_keys;
+	for (idx_t i = 0; i < row_count; i++) {
+		auto continues_run = run_keys.empty() || l_state.keys[i] >= run_keys.back();
+		if (!continues_run || run_keys.size() == SORTED_RUN_CAPACITY) {
+			ConstructRun(l_state);
+		}
+		AppendToRun(l_state.run_allocator, run_keys, l_state.keys[i]);
+		AppendToRun(l_state.run_allocator, l_state.run_row_ids, l_state.row_ids[i]);
+	}
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
@@ -138,6 +174,9 @@ SinkCombineResultType PhysicalCreateARTIndex::Combine(ExecutionContext &context,
 	auto &g_state = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
 	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
 
+	// construct the remaining sorted run
+	ConstructRun(l_state);
+
 	// merge the local index into the global index
 	if (!g_state.global_index->MergeIndexes(*l_state.local_index)) {
 		throw ConstraintException("Data contains duplicates on indexed column(s)");
@@ -15,6 +15,13 @@
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/parser/constraints/unique_constraint.hpp"
+#include "duckdb/planner/column_binding_map.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_distinct.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
 
 namespace duckdb {
 
@@ -121,6 +128,108 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 	return;
 }
 
+//! Whether the combination of the given column bindings is unique in the output of the operator
+static bool ColumnBindingsAreUnique(LogicalOperator &op, const column_binding_set_t &bindings) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_FILTER:
+		// filters only remove rows
+		return ColumnBindingsAreUnique(*op.children[0], bindings);
+	case LogicalOperatorType::LOGICAL_PROJECTION: {
+		auto &proj = op.Cast<LogicalProjection>();
+		column_binding_set_t child_bindings;
+		for (auto &binding : bindings) {
+			if (binding.table_index != proj.table_index || binding.column_index >= proj.expressions.size()) {
+				continue;
+			}
+			auto &expr = *proj.expressions[binding.column_index];
+			if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
+				child_bindings.insert(expr.Cast<BoundColumnRefExpression>().binding);
+			}
+		}
+		return ColumnBindingsAreUnique(*op.children[0], child_bindings);
+	}
+	case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY: {
+		// there is one row per group
+		auto &aggr = op.Cast<LogicalAggregate>();
+		if (aggr.grouping_sets.size() > 1) {
+			return false;
+		}
+		for (idx_t group_idx = 0; group_idx < aggr.groups.size(); group_idx++) {
+			if (bindings.find(ColumnBinding(aggr.group_index, group_idx)) == bindings.end()) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case LogicalOperatorType::LOGICAL_DISTINCT: {
+		// there is one row per combination of distinct targets
+		auto &distinct = op.Cast<LogicalDistinct>();
+		for (auto &target : distinct.distinct_targets) {
+			if (target->type != ExpressionType::BOUND_COLUMN_REF ||
+			    bindings.find(target->Cast<BoundColumnRefExpression>().binding) == bindings.end()) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case LogicalOperatorType::LOGICAL_GET: {
+		// table scan that contains all columns of a primary key or unique constraint
+		auto &get = op.Cast<LogicalGet>();
+		auto table = get.GetTable();
+		if (!table || !table->IsDuckTable()) {
+			return false;
+		}
+		auto &column_ids = get.GetColumnIds();
+		unordered_set<idx_t> key_columns;
+		for (auto &binding : bindings) {
+			if (binding.table_index != get.table_index || binding.column_index >= column_ids.size()) {
+				continue;
+			}
+			if (column_ids[binding.column_index] == COLUMN_IDENTIFIER_ROW_ID) {
+				return true;
+			}
+			key_columns.insert(column_ids[binding.column_index]);
+		}
+		for (auto &constraint : table->GetConstraints()) {
+			if (constraint->type != ConstraintType::UNIQUE) {
+				continue;
+			}
+			auto &unique = constraint->Cast<UniqueConstraint>();
+			bool covered = true;
+			if (unique.HasIndex()) {
+				covered = key_columns.find(unique.GetIndex().index) != key_columns.end();
+			} else {
+				for (auto &name : unique.GetColumnNames()) {
+					if (!table->ColumnExists(name) ||
+					    key_columns.find(table->GetColumn(name).Logical().index) == key_columns.end()) {
+						covered = false;
+						break;
+					}
+				}
+			}
+			if (covered) {
+				return true;
+			}
+		}
+		return false;
+	}
+	default:
+		return false;
+	}
+}
+
+//! Whether the keys of the build side (RHS) of the join are unique, e.g., because they contain a primary key
+static bool BuildKeysAreUnique(LogicalComparisonJoin &op) {
+	column_binding_set_t bindings;
+	for (auto &cond : op.conditions) {
+		// NULL values are never inserted for regular equality conditions, so a UNIQUE constraint suffices
+		if (cond.comparison == ExpressionType::COMPARE_EQUAL && cond.right->type == ExpressionType::BOUND_COLUMN_REF) {
+			bindings.insert(cond.right->Cast<BoundColumnRefExpression>().binding);
+		}
+	}
+	return !bindings.empty() && ColumnBindingsAreUnique(*op.children[1], bindings);
+}
+
 static void RewriteJoinCondition(Expression &expr, idx_t offset) {
 	if (expr.type == ExpressionType::BOUND_REF) {
 		auto &ref = expr.Cast<BoundReferenceExpression>();
@@ -157,6 +266,8 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 	D_ASSERT(op.children.size() == 2);
 	idx_t lhs_cardinality = op.children[0]->EstimateCardinality(context);
 	idx_t rhs_cardinality = op.children[1]->EstimateCardinality(context);
+	// this has to be determined before the children are planned
+	const auto build_keys_unique = BuildKeysAreUnique(op);
 	auto left = CreatePlan(*op.children[0]);
 	auto right = CreatePlan(*op.children[1]);
 	left->estimated_cardinality = lhs_cardinality;
@@ -194,10 +305,12 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 		// Equality join with small number of keys : possible perfect join optimization
 		PerfectHashJoinStats perfect_join_stats;
 		CheckForPerfectJoinOpt(op, perfect_join_stats);
-		plan =
+		auto hash_join =
 		    make_uniq<PhysicalHashJoin>(op, std::move(left), std::move(right), std::move(op.conditions), op.join_type,
 		                                op.left_projection_map, op.right_projection_map, std::move(op.mark_types),
 		                                op.estimated_cardinality, perfect_join_stats, std::move(op.filter_pushdown));
+		hash_join->build_keys_unique = build_keys_unique;
+		plan = std::move(hash_join);
 
 	} else {
 		if (left->estimated_cardinality <= client_config.nested_loop_join_threshold ||
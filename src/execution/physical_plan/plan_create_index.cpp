@@ -15,7 +15,7 @@ namespace duckdb {
 
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalCreateIndex &op) {
 	// generate a physical plan for the parallel index creation which consists of the following operators
-	// table scan - projection (for expression execution) - filter (NOT NULL) - order (if applicable) - create index
+	// table scan - projection (for expression execution) - filter (NOT NULL) - order - create index
 
 	D_ASSERT(op.children.size() == 1);
 	auto table_scan = CreatePlan(*op.children[0]);
@@ -76,43 +76,29 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalCreateInde
 	null_filter->types.emplace_back(LogicalType::ROW_TYPE);
 	null_filter->children.push_back(std::move(projection));
 
-	// determine if we sort the data prior to index creation
-	// we don't sort, if either VARCHAR or compound key
-	auto perform_sorting = true;
-	if (op.unbound_expressions.size() > 1) {
-		perform_sorting = false;
-	} else if (op.unbound_expressions[0]->return_type.InternalType() == PhysicalType::VARCHAR) {
-		perform_sorting = false;
-	}
-
 	// actual physical create index operator
 
 	auto physical_create_index =
 	    make_uniq<PhysicalCreateARTIndex>(op, op.table, op.info->column_ids, std::move(op.info),
-	                                      std::move(op.unbound_expressions), op.estimated_cardinality, perform_sorting);
+	                                      std::move(op.unbound_expressions), op.estimated_cardinality, true);
 
-	if (perform_sorting) {
-
-		// optional order operator
-		vector<BoundOrderByNode> orders;
-		vector<idx_t> projections;
-		for (idx_t i = 0; i < new_column_types.size() - 1; i++) {
-			auto col_expr = make_uniq_base<Expression, BoundReferenceExpression>(new_column_types[i], i);
-			orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_FIRST, std::move(col_expr));
-			projections.emplace_back(i);
-		}
-		projections.emplace_back(new_column_types.size() - 1);
+	// order operator, so that the index can be constructed bottom-up from sorted runs of keys
+	// the ART key encoding preserves the sort order, including for VARCHAR and compound keys
 
-		auto physical_order = make_uniq<PhysicalOrder>(new_column_types, std::move(orders), std::move(projections),
-		                                               op.estimated_cardinality);
-		physical_order->children.push_back(std::move(null_filter));
+	vector<BoundOrderByNode> orders;
+	vector<idx_t> projections;
+	for (idx_t i = 0; i < new_column_types.size() - 1; i++) {
+		auto col_expr = make_uniq_base<Expression, BoundReferenceExpression>(new_column_types[i], i);
+		orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_FIRST, std::move(col_expr));
+		projections.emplace_back(i);
+	}
+	projections.emplace_back(new_column_types.size() - 1);
 
-		physical_create_index->children.push_back(std::move(physical_order));
-	} else {
+	auto physical_order = make_uniq<PhysicalOrder>(new_column_types, std::move(orders), std::move(projections),
+	                                               op.estimated_cardinality);
+	physical_order->children.push_back(std::move(null_filter));
 
-		// no ordering
-		physical_create_index->children.push_back(std::move(null_filter));
-	}
+	physical_create_index->children.push_back(std::move(physical_order));
 
 	return std::move(physical_create_index);
 }
@@ -0,0 +1,92 @@
+#include "duckdb/function/table/system_functions.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/index_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/enum_util.hpp"
+#include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/parser/qualified_name.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/append_state.hpp"
+
+namespace duckdb {
+
+struct PragmaIndexMemoryInfoFunctionData : public TableFunctionData {
+	vector<ARTNodeMemoryInfo> node_infos;
+};
+
+struct PragmaIndexMemoryInfoOperatorData : public GlobalTableFunctionState {
+	PragmaIndexMemoryInfoOperatorData() : offset(0) {
+	}
+
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> PragmaIndexMemoryInfoBind(ClientContext &context, TableFunctionBindInput &input,
+                                                          vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("node_type");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("segment_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("segment_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("memory_usage");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	auto qname = QualifiedName::Parse(input.inputs[0].GetValue<string>());
+
+	// look up the index and its table in the catalog
+	Binder::BindSchemaOrCatalog(context, qname.catalog, qname.schema);
+	auto &index_entry = Catalog::GetEntry<IndexCatalogEntry>(context, qname.catalog, qname.schema, qname.name);
+	auto &table_entry = Catalog::GetEntry<TableCatalogEntry>(context, index_entry.catalog.GetName(),
+	                                                         index_entry.GetSchemaName(), index_entry.GetTableName());
+
+	auto result = make_uniq<PragmaIndexMemoryInfoFunctionData>();
+	auto &info = table_entry.GetStorage().GetDataTableInfo();
+	info->GetIndexes().BindAndScan<ART>(context, *info, [&](ART &art) {
+		if (art.GetIndexName() != index_entry.name) {
+			return false;
+		}
+		IndexLock index_lock;
+		art.InitializeLock(index_lock);
+		result->node_infos = art.GetNodeMemoryInfo(index_lock);
+		return true;
+	});
+	return std::move(result);
+}
+
+unique_ptr<GlobalTableFunctionState> PragmaIndexMemoryInfoInit(ClientContext &context, TableFunctionInitInput &input) {
+	return make_uniq<PragmaIndexMemoryInfoOperatorData>();
+}
+
+static void PragmaIndexMemoryInfoFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &bind_data = data_p.bind_data->Cast<PragmaIndexMemoryInfoFunctionData>();
+	auto &data = data_p.global_state->Cast<PragmaIndexMemoryInfoOperatorData>();
+	idx_t count = 0;
+	while (data.offset < bind_data.node_infos.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = bind_data.node_infos[data.offset++];
+
+		idx_t col_idx = 0;
+		// node_type
+		output.SetValue(col_idx++, count, Value(EnumUtil::ToString(entry.type)));
+		// segment_size
+		output.SetValue(col_idx++, count, Value::BIGINT(NumericCast<int64_t>(entry.segment_size)));
+		// segment_count
+		output.SetValue(col_idx++, count, Value::BIGINT(NumericCast<int64_t>(entry.segment_count)));
+		// memory_usage
+		output.SetValue(col_idx++, count, Value::BIGINT(NumericCast<int64_t>(entry.in_memory_size)));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void PragmaIndexMemoryInfo::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("pragma_index_memory_info", {LogicalType::VARCHAR}, PragmaIndexMemoryInfoFunction,
+	                              PragmaIndexMemoryInfoBind, PragmaIndexMemoryInfoInit));
+}
+
+} // namespace duckdb
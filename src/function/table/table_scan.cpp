@@ -326,44 +326,41 @@ void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, Fun
 
 	// bind and scan any ART indexes
 	info->GetIndexes().BindAndScan<ART>(context, *info, [&](ART &art_index) {
-		// first rewrite the index expression so the ColumnBindings align with the column bindings of the current table
-		if (art_index.unbound_expressions.size() > 1) {
-			// NOTE: index scans are not (yet) supported for compound index keys
-			return false;
-		}
-
-		auto index_expression = art_index.unbound_expressions[0]->Copy();
-		bool rewrite_possible = true;
-		RewriteIndexExpression(art_index, get, *index_expression, rewrite_possible);
-		if (!rewrite_possible) {
-			// could not rewrite!
-			return false;
+		// first rewrite the index expressions so the ColumnBindings align with the column bindings of the current table
+		vector<unique_ptr<Expression>> index_expressions;
+		for (auto &unbound_expression : art_index.unbound_expressions) {
+			auto index_expression = unbound_expression->Copy();
+			bool rewrite_possible = true;
+			RewriteIndexExpression(art_index, get, *index_expression, rewrite_possible);
+			if (!rewrite_possible) {
+				// could not rewrite!
+				return false;
+			}
+			index_expressions.push_back(std::move(index_expression));
 		}
 
-		// Try to find a matching index for any of the filter expressions.
-		for (auto &filter : filters) {
-			auto index_state = art_index.TryInitializeScan(*index_expression, *filter);
-			if (index_state != nullptr) {
+		// Try to find matching filters for the (leading) index expressions.
+		auto index_state = art_index.TryInitializeScan(index_expressions, filters);
+		if (index_state != nullptr) {
 
-				auto &db_config = DBConfig::GetConfig(context);
-				auto index_scan_percentage = db_config.options.index_scan_percentage;
-				auto index_scan_max_count = db_config.options.index_scan_max_count;
+			auto &db_config = DBConfig::GetConfig(context);
+			auto index_scan_percentage = db_config.options.index_scan_percentage;
+			auto index_scan_max_count = db_config.options.index_scan_max_count;
 
-				auto total_rows = storage.GetTotalRows();
-				auto total_rows_from_percentage = LossyNumericCast<idx_t>(double(total_rows) * index_scan_percentage);
-				auto max_count = MaxValue(index_scan_max_count, total_rows_from_percentage);
+			auto total_rows = storage.GetTotalRows();
+			auto total_rows_from_percentage = LossyNumericCast<idx_t>(double(total_rows) * index_scan_percentage);
+			auto max_count = MaxValue(index_scan_max_count, total_rows_from_percentage);
 
-				// Check if we can use an index scan, and already retrieve the matching row ids.
-				if (art_index.Scan(*index_state, max_count, bind_data.row_ids)) {
-					bind_data.is_index_scan = true;
-					get.function = TableScanFunction::GetIndexScanFunction();
-					return true;
-				}
-
-				// Clear the row ids in case we exceeded the maximum count and stopped scanning.
-				bind_data.row_ids.clear();
+			// Check if we can use an index scan, and already retrieve the matching row ids.
+			if (art_index.Scan(*index_state, max_count, bind_data.row_ids)) {
+				bind_data.is_index_scan = true;
+				get.function = TableScanFunction::GetIndexScanFunction();
 				return true;
 			}
+
+			// Clear the row ids in case we exceeded the maximum count and stopped scanning.
+			bind_data.row_ids.clear();
+			return true;
 		}
 		return false;
 	});
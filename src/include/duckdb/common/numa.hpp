@@ -0,0 +1,26 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/numa.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/file_system.hpp"
+
+namespace duckdb {
+
+class NUMA {
+public:
+	//! Returns the CPUs of every NUMA node of the system, or an empty list if the topology is not available
+	static vector<vector<idx_t>> GetNodeCPUs(FileSystem &fs);
+
+private:
+	//! Parses a kernel CPU list (e.g. "0-3,8-11")
+	static vector<idx_t> ParseCPUList(const string &cpu_list);
+};
+
+} // namespace duckdb
@@ -43,9 +43,12 @@ public:
 		throw NotImplementedException("Cannot read data from this type");
 	}
 
-	static inline void EncodeStringDataPrefix(data_ptr_t dataptr, string_t value, idx_t prefix_len) {
-		auto len = value.GetSize();
-		memcpy(dataptr, value.GetData(), MinValue(len, prefix_len));
+	static inline void EncodeStringDataPrefix(data_ptr_t dataptr, string_t value, idx_t prefix_len,
+	                                          idx_t prefix_offset = 0) {
+		D_ASSERT(value.GetSize() >= prefix_offset);
+		prefix_offset = MinValue<idx_t>(value.GetSize(), prefix_offset);
+		auto len = value.GetSize() - prefix_offset;
+		memcpy(dataptr, value.GetData() + prefix_offset, MinValue(len, prefix_len));
 		if (len < prefix_len) {
 			memset(dataptr + len, '\0', prefix_len - len);
 		}
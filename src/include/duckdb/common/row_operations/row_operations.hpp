@@ -121,9 +121,10 @@ struct RowOperations {
 	// Sorting Operators
 	//===--------------------------------------------------------------------===//
 	//! Scatter vector data to the rows in radix-sortable format.
+	//! For strings, the first 'prefix_offset' bytes are skipped (these must be shared by all strings)
 	static void RadixScatter(Vector &v, idx_t vcount, const SelectionVector &sel, idx_t ser_count,
 	                         data_ptr_t key_locations[], bool desc, bool has_null, bool nulls_first, idx_t prefix_len,
-	                         idx_t width, idx_t offset = 0);
+	                         idx_t width, idx_t offset = 0, idx_t prefix_offset = 0);
 
 	//===--------------------------------------------------------------------===//
 	// Out-of-Core Operators
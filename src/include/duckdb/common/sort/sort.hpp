@@ -22,6 +22,8 @@ struct SortConstants {
 	static constexpr idx_t MSD_RADIX_LOCATIONS = VALUES_PER_RADIX + 1;
 	static constexpr idx_t INSERTION_SORT_THRESHOLD = 24;
 	static constexpr idx_t MSD_RADIX_SORT_SIZE_THRESHOLD = 4;
+	//! Maximum number of sorted blocks that are merged in a single (k-way) merge round
+	static constexpr idx_t MERGE_FAN_IN = 8;
 };
 
 struct SortLayout {
@@ -41,6 +43,9 @@ public:
 	vector<bool> constant_size;
 	vector<idx_t> column_sizes;
 	vector<idx_t> prefix_lengths;
+	//! Number of leading bytes that all strings of a column share (according to the statistics)
+	//! These are not stored in the sorting key, so the prefix holds the bytes that actually differ
+	vector<idx_t> prefix_offsets;
 	vector<BaseStatistics *> stats;
 	vector<bool> has_null;
 
@@ -92,10 +97,14 @@ public:
 	bool external;
 
 	//! Progress in merge path stage
+	//! A "pair" holds up to 'merge_fan_in' sorted blocks, pairs of more than two blocks are merged k-way
 	idx_t pair_idx;
 	idx_t num_pairs;
+	idx_t merge_fan_in;
 	idx_t l_start;
 	idx_t r_start;
+	//! Start indices of the sorted blocks of the current pair (k-way merge only)
+	vector<idx_t> k_way_starts;
 };
 
 struct LocalSortState {
@@ -170,6 +179,10 @@ private:
 	unique_ptr<SortedBlock> right_input;
 	SortedBlock *result;
 
+	//! Readers and input blocks of a k-way merge partition
+	vector<unique_ptr<SBScanState>> k_way_readers;
+	vector<unique_ptr<SortedBlock>> k_way_inputs;
+
 private:
 	//! Computes the left and right block that will be merged next (Merge Path partition)
 	void GetNextPartition();
@@ -177,9 +190,32 @@ private:
 	void GetIntersection(const idx_t diagonal, idx_t &l_idx, idx_t &r_idx);
 	//! Compare values within SortedBlocks using a global index
 	int CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const idx_t l_idx, const idx_t r_idx);
+	//! Compare values within SortedBlocks using a global index, without using the merge path progress
+	int CompareAtGlobalIndex(SBScanState &l, SBScanState &r, const idx_t l_idx, const idx_t r_idx);
+
+	//! Computes the slices of all blocks of the current pair that will be merged next (k-way Merge Path partition)
+	void GetNextKWayPartition(const idx_t block_start, const idx_t block_count);
+	//! Finds the ends of the next k-way partition, such that exactly 'diagonal' rows come before them
+	void GetKWayIntersection(const idx_t diagonal, vector<unique_ptr<SBScanState>> &readers, vector<idx_t> &ends);
+	//! Counts the rows before the row at 'idx' in block 'block_idx' across all blocks, and stores the ends
+	idx_t GetKWayRank(vector<unique_ptr<SBScanState>> &readers, const vector<idx_t> &bounds, const idx_t block_idx,
+	                  const idx_t idx, vector<idx_t> &ends);
 
 	//! Finds the next partition and merges it
 	void MergePartition();
+	//! Merges the slices of a k-way partition into the result in a single pass
+	void MergeKWayPartition();
+	//! Moves a k-way reader to its next row (if needed) and pins it, returns false if the reader is exhausted
+	bool PositionKWayReader(SBScanState &reader);
+	//! Whether the next row of k-way reader 'a' comes before the next row of k-way reader 'b'
+	bool KWayRowBefore(const idx_t a, const idx_t b);
+	//! Computes which k-way reader each of the next 'count' tuples comes from, using a binary heap of the readers
+	void ComputeKWayMerge(const idx_t &count, idx_t next_sources[]);
+	//! Merges the radix sorting blocks of the k-way readers according to the 'next_sources' array
+	void MergeKWayRadix(const idx_t &count, const idx_t next_sources[]);
+	//! Merges the SortedData of the k-way readers according to the 'next_sources' array
+	void MergeKWayData(SortedData &result_data, const idx_t &count, const idx_t next_sources[],
+	                   idx_t next_entry_sizes[], bool reset_indices);
 
 	//! Computes how the next 'count' tuples should be merged by setting the 'left_smaller' array
 	void ComputeMerge(const idx_t &count, bool left_smaller[]);
@@ -0,0 +1,71 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/types/blocked_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+
+class Serializer;
+class Deserializer;
+
+//! A register-blocked Bloom filter over 64-bit hashes
+//! Every key sets (and probes) NUM_BITS bits within a single 64-bit block, so a lookup costs exactly one memory access
+class BlockedBloomFilter {
+public:
+	//! The number of bits set per key
+	static constexpr const idx_t NUM_BITS = 4;
+	//! The number of bits reserved per expected key
+	static constexpr const idx_t BITS_PER_KEY = 16;
+	//! The maximum number of 64-bit blocks (128MB)
+	static constexpr const idx_t MAX_BLOCK_COUNT = idx_t(1) << 24;
+
+public:
+	explicit BlockedBloomFilter(idx_t expected_count);
+
+	//! Insert the first "count" hashes of a flat hash vector into the filter
+	//! If "parallel" is set, the blocks are updated atomically so multiple threads can insert concurrently
+	void Insert(Vector &hashes, idx_t count, bool parallel);
+
+	//! Whether or not the filter may contain the hash
+	inline bool Lookup(const hash_t hash) const {
+		const auto mask = GetMask(hash);
+		return (blocks[GetBlockIndex(hash)] & mask) == mask;
+	}
+
+	idx_t BlockCount() const {
+		return block_count;
+	}
+	idx_t SizeInBytes() const {
+		return block_count * sizeof(uint64_t);
+	}
+
+	void Serialize(Serializer &serializer) const;
+	static shared_ptr<BlockedBloomFilter> Deserialize(Deserializer &deserializer);
+
+private:
+	inline idx_t GetBlockIndex(const hash_t hash) const {
+		return (hash >> 32) & bitmask;
+	}
+	static inline uint64_t GetMask(const hash_t hash) {
+		return (uint64_t(1) << (hash & 63)) | (uint64_t(1) << ((hash >> 6) & 63)) |
+		       (uint64_t(1) << ((hash >> 12) & 63)) | (uint64_t(1) << ((hash >> 18) & 63));
+	}
+
+private:
+	//! The number of blocks (always a power of two)
+	idx_t block_count;
+	//! Mask to go from a hash to a block index
+	idx_t bitmask;
+	//! The blocks of the filter
+	unsafe_unique_array<uint64_t> blocks;
+};
+
+} // namespace duckdb
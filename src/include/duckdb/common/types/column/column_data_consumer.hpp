@@ -21,6 +21,7 @@ struct ColumnDataConsumerScanState {
 };
 
 //! ColumnDataConsumer can scan a ColumnDataCollection, and consume it in the process, i.e., read blocks are deleted
+//! (unless "consume" is set to false, then the collection can be scanned again afterwards)
 class ColumnDataConsumer {
 public:
 	struct ChunkReference {
@@ -42,7 +43,7 @@ public:
 	};
 
 public:
-	ColumnDataConsumer(ColumnDataCollection &collection, vector<column_t> column_ids);
+	ColumnDataConsumer(ColumnDataCollection &collection, vector<column_t> column_ids, bool consume = true);
 
 	idx_t Count() const {
 		return collection.Count();
@@ -71,6 +72,8 @@ private:
 	ColumnDataCollection &collection;
 	//! The column ids to scan
 	vector<column_t> column_ids;
+	//! Whether read blocks are deleted
+	bool consume;
 	//! The number of chunk references
 	idx_t chunk_count;
 	//! The chunks (in order) to be scanned
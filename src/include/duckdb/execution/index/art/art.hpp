@@ -29,6 +29,14 @@ class FixedSizeAllocator;
 
 struct ARTIndexScanState;
 
+//! The memory usage of the nodes of a node type.
+struct ARTNodeMemoryInfo {
+	NType type;
+	idx_t segment_size;
+	idx_t segment_count;
+	idx_t in_memory_size;
+};
+
 class ART : public BoundIndex {
 public:
 	friend class Leaf;
@@ -40,6 +48,8 @@ public:
 	static constexpr uint8_t ALLOCATOR_COUNT = 9;
 	//! FixedSizeAllocator count of deprecated ARTs.
 	static constexpr uint8_t DEPRECATED_ALLOCATOR_COUNT = ALLOCATOR_COUNT - 3;
+	//! Set in the active lookup count while the last lookup releases the pins of the on-disk buffers.
+	static constexpr idx_t RELEASING_PINS = idx_t(1) << 63;
 
 public:
 	ART(const string &name, const IndexConstraintType index_constraint_type, const vector<column_t> &column_ids,
@@ -65,8 +75,11 @@ public:
 	uint8_t prefix_count;
 
 public:
-	//! Try to initialize a scan on the ART with the given expression and filter.
-	unique_ptr<IndexScanState> TryInitializeScan(const Expression &expr, const Expression &filter_expr);
+	//! Try to initialize a scan on the ART with the given key expressions and filters.
+	//! Equality filters on a prefix of the key expressions, followed by range or string prefix filters
+	//! on the next key expression, are scanned as a single range of keys.
+	unique_ptr<IndexScanState> TryInitializeScan(const vector<unique_ptr<Expression>> &exprs,
+	                                             const vector<unique_ptr<Expression>> &filter_exprs);
 	//! Perform a lookup on the ART, fetching up to max_count row IDs.
 	//! If all row IDs were fetched, it return true, else false.
 	bool Scan(IndexScanState &state, idx_t max_count, unsafe_vector<row_t> &row_ids);
@@ -99,6 +112,8 @@ public:
 	IndexStorageInfo GetStorageInfo(const case_insensitive_map_t<Value> &options, const bool to_wal) override;
 	//! Returns the in-memory usage of the ART.
 	idx_t GetInMemorySize(IndexLock &index_lock) override;
+	//! Returns the memory usage of the ART per node type.
+	vector<ARTNodeMemoryInfo> GetNodeMemoryInfo(IndexLock &index_lock);
 
 	//! ART key generation.
 	template <bool IS_NOT_NULL = false>
@@ -117,6 +132,8 @@ private:
 	bool SearchLess(ARTKey &upper_bound, bool equal, idx_t max_count, unsafe_vector<row_t> &row_ids);
 	bool SearchCloseRange(ARTKey &lower_bound, ARTKey &upper_bound, bool left_equal, bool right_equal, idx_t max_count,
 	                      unsafe_vector<row_t> &row_ids);
+	bool SearchKeyRange(ARTIndexScanState &state, idx_t max_count, unsafe_vector<row_t> &row_ids);
+	bool ScanInternal(ARTIndexScanState &scan_state, idx_t max_count, unsafe_vector<row_t> &row_ids);
 	const unsafe_optional_ptr<const Node> Lookup(const Node &node, const ARTKey &key, idx_t depth);
 
 	void InsertIntoEmpty(Node &node, const ARTKey &key, const idx_t depth, const ARTKey &row_id,
@@ -148,6 +165,24 @@ private:
 
 	string VerifyAndToStringInternal(const bool only_verify);
 	void VerifyAllocationsInternal();
+
+private:
+	//! Registers a lookup (a scan or a constraint check) that holds the shared lock for its lifetime.
+	//! Lookups only pin the on-disk buffers that they read, and the last active lookup releases these pins again,
+	//! so that the buffer manager can evict the buffers.
+	class LookupScope {
+	public:
+		explicit LookupScope(ART &art);
+		~LookupScope();
+
+	private:
+		ART &art;
+	};
+
+	//! The number of active lookups, see LookupScope.
+	atomic<idx_t> active_lookups;
+	//! Lookups wait on this lock while the pins are being released.
+	mutex release_lock;
 };
 
 template <>
@@ -42,26 +42,31 @@ public:
 
 	//! Returns true, if the byte exists, else false.
 	bool HasByte(uint8_t &byte) const {
-		for (uint8_t i = 0; i < count; i++) {
-			if (key[i] == byte) {
-				return true;
-			}
-		}
-		return false;
+		auto pos = LowerBound(byte);
+		return pos < count && key[pos] == byte;
 	}
 
 	//! Get the first byte greater than or equal to the byte.
 	//! Returns true, if such a byte exists, else false.
 	bool GetNextByte(uint8_t &byte) const {
-		for (uint8_t i = 0; i < count; i++) {
-			if (key[i] >= byte) {
-				byte = key[i];
-				return true;
-			}
+		auto pos = LowerBound(byte);
+		if (pos < count) {
+			byte = key[pos];
+			return true;
 		}
 		return false;
 	}
 
+	//! Returns the position of the first byte greater than or equal to the byte.
+	//! Like BaseNode::LowerBound, this counts the smaller (sorted) bytes instead of branching on each of them.
+	inline uint8_t LowerBound(const uint8_t byte) const {
+		uint8_t pos = 0;
+		for (uint8_t i = 0; i < count; i++) {
+			pos += key[i] < byte;
+		}
+		return pos;
+	}
+
 private:
 	static void InsertByteInternal(BaseLeaf &n, const uint8_t byte);
 	static BaseLeaf &DeleteByteInternal(ART &art, Node &node, const uint8_t byte);
@@ -67,26 +67,34 @@ public:
 
 	//! Get the child at byte.
 	static unsafe_optional_ptr<Node> GetChild(BaseNode &n, const uint8_t byte) {
-		for (uint8_t i = 0; i < n.count; i++) {
-			if (n.key[i] == byte) {
-				D_ASSERT(n.children[i].HasMetadata());
-				return &n.children[i];
-			}
+		auto pos = LowerBound(n, byte);
+		if (pos < n.count && n.key[pos] == byte) {
+			D_ASSERT(n.children[pos].HasMetadata());
+			return &n.children[pos];
 		}
 		return nullptr;
 	}
 
 	//! Get the first child greater than or equal to the byte.
 	static unsafe_optional_ptr<Node> GetNextChild(BaseNode &n, uint8_t &byte) {
-		for (uint8_t i = 0; i < n.count; i++) {
-			if (n.key[i] >= byte) {
-				byte = n.key[i];
-				return &n.children[i];
-			}
+		auto pos = LowerBound(n, byte);
+		if (pos < n.count) {
+			byte = n.key[pos];
+			return &n.children[pos];
 		}
 		return nullptr;
 	}
 
+	//! Returns the position of the first key greater than or equal to the byte.
+	//! The keys are sorted, so we count the keys less than the byte instead of branching on each of them.
+	static inline uint8_t LowerBound(const BaseNode &n, const uint8_t byte) {
+		uint8_t pos = 0;
+		for (uint8_t i = 0; i < n.count; i++) {
+			pos += n.key[i] < byte;
+		}
+		return pos;
+	}
+
 public:
 	template <class F>
 	static void Iterator(BaseNode<CAPACITY, TYPE> &n, F &&lambda) {
@@ -66,6 +66,12 @@ public:
 		D_ASSERT(ptr.GetType() != NType::PREFIX);
 		return *(GetAllocator(art, type).Get<NODE>(ptr, !std::is_const<NODE>::value));
 	}
+	//! Get a reference to a node, and only mark its buffer as dirty, if the node is mutable.
+	template <class NODE>
+	static inline NODE &Ref(const ART &art, const Node ptr, const NType type, const bool is_mutable) {
+		D_ASSERT(ptr.GetType() != NType::PREFIX);
+		return *(GetAllocator(art, type).Get<NODE>(ptr, is_mutable));
+	}
 	//! Get a node pointer, if the node is in memory, else nullptr.
 	template <class NODE>
 	static inline unsafe_optional_ptr<NODE> InMemoryRef(const ART &art, const Node ptr, const NType type) {
@@ -17,6 +17,7 @@
 #include "duckdb/planner/expression.hpp"
 #include "duckdb/storage/table_storage_info.hpp"
 #include "duckdb/storage/index.hpp"
+#include "duckdb/storage/storage_lock.hpp"
 
 namespace duckdb {
 
@@ -65,7 +66,7 @@ public:
 	}
 
 public: // Index interface
-	//! Obtain a lock on the index
+	//! Obtain an exclusive lock on the index
 	void InitializeLock(IndexLock &state);
 	//! Called when data is appended to the index. The lock obtained from InitializeLock must be held
 	virtual ErrorData Append(IndexLock &state, DataChunk &entries, Vector &row_identifiers) = 0;
@@ -133,16 +134,13 @@ public: // Index interface
 	vector<unique_ptr<Expression>> unbound_expressions;
 
 protected:
-	//! Lock used for any changes to the index
-	mutex lock;
+	//! Lock used for any changes to the index (exclusive), and for lookups and scans (shared)
+	StorageLock lock;
 
 	//! Bound expressions used during expression execution
 	vector<unique_ptr<Expression>> bound_expressions;
 
 private:
-	//! Expression executor to execute the index expressions
-	ExpressionExecutor executor;
-
 	//! Bind the unbound expressions of the index
 	unique_ptr<Expression> BindExpression(unique_ptr<Expression> expr);
 };
@@ -10,6 +10,7 @@
 
 #include "duckdb/common/constants.hpp"
 #include "duckdb/common/map.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/types/validity_mask.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/unordered_set.hpp"
@@ -55,6 +56,16 @@ public:
 		D_ASSERT(buffers.find(ptr.GetBufferId()) != buffers.end());
 
 		auto &buffer = buffers.find(ptr.GetBufferId())->second;
+		if (!dirty && InLookup()) {
+			// Lookups only pin the on-disk block of a buffer, so that it can be evicted after the lookups
+			if (!buffer.Readable()) {
+				PinBuffer(ptr.GetBufferId(), buffer);
+			}
+			return buffer.GetForLookup() + ptr.GetOffset() * segment_size + bitmask_offset;
+		}
+		if (!buffer.InMemory()) {
+			LoadBuffer(buffer);
+		}
 		auto buffer_ptr = buffer.Get(dirty);
 		return buffer_ptr + ptr.GetOffset() * segment_size + bitmask_offset;
 	}
@@ -82,6 +93,13 @@ public:
 
 	//! Resets the allocator, e.g., during 'DELETE FROM table'
 	void Reset();
+	//! Sets the number of active lookups of the owning index. While there are active lookups, read-only accesses
+	//! pin the on-disk blocks of the buffers instead of loading them
+	void SetActiveLookups(const atomic<idx_t> &active_lookups_p) {
+		active_lookups = &active_lookups_p;
+	}
+	//! Releases the pins of all on-disk blocks. There must not be any active lookups
+	void ReleasePins();
 
 	//! Returns the in-memory size in bytes
 	idx_t GetInMemorySize() const;
@@ -153,10 +171,24 @@ private:
 	unordered_set<idx_t> buffers_with_free_space;
 	//! Buffers qualifying for a vacuum (helper field to allow for fast NeedsVacuum checks)
 	unordered_set<idx_t> vacuum_buffers;
+	//! Lookups only hold a shared lock on the index, so we serialize loading buffers from disk
+	mutex load_lock;
+	//! The number of active lookups of the owning index, if any
+	optional_ptr<const atomic<idx_t>> active_lookups;
+	//! The buffers whose on-disk blocks are pinned by lookups
+	vector<idx_t> pinned_buffers;
 
 private:
 	//! Returns an available buffer id
 	idx_t GetAvailableBufferId() const;
+	//! Pins a buffer that is not yet in memory
+	void LoadBuffer(FixedSizeBuffer &buffer);
+	//! Pins the on-disk block of a buffer that is not yet readable
+	void PinBuffer(const idx_t buffer_id, FixedSizeBuffer &buffer);
+	//! Returns true, if the owning index has active lookups
+	inline bool InLookup() const {
+		return active_lookups && active_lookups->load() != 0;
+	}
 };
 
 } // namespace duckdb
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/storage/partial_block_manager.hpp"
 #include "duckdb/storage/buffer/block_handle.hpp"
 #include "duckdb/storage/buffer/buffer_handle.hpp"
@@ -45,6 +46,8 @@ public:
 	//! Constructor for deserializing buffer metadata from disk
 	FixedSizeBuffer(BlockManager &block_manager, const idx_t segment_count, const idx_t allocation_size,
 	                const BlockPointer &block_pointer);
+	//! Move constructor, used when inserting a buffer into an allocator
+	FixedSizeBuffer(FixedSizeBuffer &&other) noexcept;
 
 	//! Block manager of the database instance
 	BlockManager &block_manager;
@@ -65,12 +68,16 @@ public:
 public:
 	//! Returns true, if the buffer is in-memory
 	inline bool InMemory() const {
-		return buffer_handle.IsValid();
+		return in_memory;
 	}
 	//! Returns true, if the block is on-disk
 	inline bool OnDisk() const {
 		return block_pointer.IsValid();
 	}
+	//! Returns true, if lookups can read the buffer, i.e., if it is in memory or if its on-disk block is pinned
+	inline bool Readable() const {
+		return in_memory || pinned;
+	}
 	//! Returns a pointer to the buffer in memory, and calls Deserialize, if the buffer is not in memory
 	inline data_ptr_t Get(const bool dirty_p = true) {
 		if (!InMemory()) {
@@ -81,6 +88,14 @@ public:
 		}
 		return buffer_handle.Ptr();
 	}
+	//! Returns a pointer to the buffer for a lookup, which must not modify the buffer. Requires Readable()
+	inline data_ptr_t GetForLookup() const {
+		if (InMemory()) {
+			return buffer_handle.Ptr();
+		}
+		D_ASSERT(pinned);
+		return pinned_handle.Ptr() + block_pointer.offset;
+	}
 	//! Destroys the in-memory buffer and the on-disk block
 	void Destroy();
 	//! Serializes a buffer (if dirty or not on disk)
@@ -88,6 +103,10 @@ public:
 	               const idx_t bitmask_offset);
 	//! Pin a buffer (if not in-memory)
 	void Pin();
+	//! Pins the on-disk block of the buffer without loading a copy of it, so that lookups can read it
+	void PinOnDisk();
+	//! Releases the pin of the on-disk block, so that the buffer manager can evict it
+	void Unpin();
 	//! Returns the first free offset in a bitmask
 	uint32_t GetOffset(const idx_t bitmask_count);
 	//! Sets the allocation size, if dirty
@@ -98,6 +117,12 @@ private:
 	BufferHandle buffer_handle;
 	//! The block handle of the on-disk buffer
 	shared_ptr<BlockHandle> block_handle;
+	//! True, if the buffer handle holds the in-memory buffer. Concurrent lookups check this flag before pinning
+	atomic<bool> in_memory;
+	//! The buffer handle of the pinned on-disk block, while lookups read the buffer without loading it
+	BufferHandle pinned_handle;
+	//! True, if the on-disk block is pinned by lookups
+	atomic<bool> pinned;
 
 private:
 	//! Sets all uninitialized regions of a buffer in the respective partial block allocation
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/types/blocked_bloom_filter.hpp"
 #include "duckdb/common/types/column/column_data_consumer.hpp"
 #include "duckdb/common/types/column/partitioned_column_data.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
@@ -71,6 +72,8 @@ public:
 		TupleDataChunkState &key_state;
 		//! Directly point to the entry in the hash table
 		Vector pointers;
+		//! The matching entries collected while following the chains (see NextInnerJoinChains)
+		Vector chain_pointers;
 		idx_t count;
 		SelectionVector sel_vector;
 		SelectionVector chain_match_sel_vector;
@@ -91,6 +94,8 @@ public:
 	private:
 		//! Next operator for the inner join
 		void NextInnerJoin(DataChunk &keys, DataChunk &left, DataChunk &result);
+		//! Next operator for the inner join that follows the chains until the result is full (no non-equality predicates)
+		void NextInnerJoinChains(DataChunk &left, DataChunk &result);
 		//! Next operator for the semi join
 		void NextSemiJoin(DataChunk &keys, DataChunk &left, DataChunk &result);
 		//! Next operator for the anti join
@@ -257,6 +262,10 @@ public:
 	uint64_t bitmask = DConstants::INVALID_INDEX;
 	//! Whether or not we error on multiple rows found per match in a SINGLE join
 	bool single_join_error_on_multiple_rows = true;
+	//! Whether the build keys are known to be unique, rows are then inserted without comparing their keys
+	bool build_keys_unique = false;
+	//! Bloom filter over the hashes of the build side (if any) - filled while inserting the hashes in Finalize
+	shared_ptr<BlockedBloomFilter> bloom_filter;
 
 	struct {
 		mutex mj_lock;
@@ -348,6 +357,10 @@ public:
 		//! Scans and consumes the ColumnDataCollection
 		unique_ptr<ColumnDataConsumer> consumer;
 
+	private:
+		//! Initialize the consumer for the global spill collection
+		void PrepareConsumer();
+
 	private:
 		JoinHashTable &ht;
 		mutex lock;
@@ -379,6 +392,22 @@ public:
 		return partition_end;
 	}
 
+	//! Whether the current partitions are built in multiple passes because they do not fit in memory
+	bool IsMultiPassBuild() const {
+		return build_chunks_per_pass != DConstants::INVALID_INDEX;
+	}
+	//! First and last chunk of the data collection that are inserted into the pointer table in the current pass
+	idx_t GetBuildChunkStart() const {
+		return IsMultiPassBuild() ? build_chunk_start : 0;
+	}
+	idx_t GetBuildChunkEnd() const {
+		return IsMultiPassBuild() ? build_chunk_end : data_collection->ChunkCount();
+	}
+	//! Whether there are chunks of the current partitions left that have not been built yet
+	bool HasNextBuildPass() const {
+		return IsMultiPassBuild() && build_chunk_end < data_collection->ChunkCount();
+	}
+
 	//! Capacity of the pointer table given the ht count
 	//! (minimum of 1024 to prevent collision chance for small HT's)
 	static idx_t PointerTableCapacity(idx_t count) {
@@ -396,9 +425,9 @@ public:
 	                   idx_t &max_partition_size, idx_t &max_partition_count) const;
 	//! Get the remaining size of the unbuilt partitions
 	idx_t GetRemainingSize() const;
-	//! Sets number of radix bits according to the max ht size
+	//! Sets number of radix bits according to the max ht size (up to max_radix_bits)
 	void SetRepartitionRadixBits(const idx_t max_ht_size, const idx_t max_partition_size,
-	                             const idx_t max_partition_count);
+	                             const idx_t max_partition_count, const idx_t max_radix_bits);
 	//! Partition this HT
 	void Repartition(JoinHashTable &global_ht);
 
@@ -406,6 +435,8 @@ public:
 	void Reset();
 	//! Build HT for the next partitioned probe round
 	bool PrepareExternalFinalize(const idx_t max_ht_size);
+	//! Build HT for the next pass over the current partitions (if they are built in multiple passes)
+	bool PrepareNextBuildPass();
 	//! Probe whatever we can, sink the rest into a thread-local HT
 	void ProbeAndSpill(ScanStructure &scan_structure, DataChunk &keys, TupleDataChunkState &key_state,
 	                   ProbeState &probe_state, DataChunk &payload, ProbeSpill &probe_spill,
@@ -418,6 +449,12 @@ private:
 	//! First and last partition of the current probe round
 	idx_t partition_start;
 	idx_t partition_end;
+
+	//! The number of chunks that are built per pass if the current partitions do not fit in memory
+	idx_t build_chunks_per_pass = DConstants::INVALID_INDEX;
+	//! First and last chunk of the current pass
+	idx_t build_chunk_start = 0;
+	idx_t build_chunk_end = 0;
 };
 
 } // namespace duckdb
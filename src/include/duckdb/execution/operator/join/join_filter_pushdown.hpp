@@ -13,8 +13,10 @@
 #include "duckdb/planner/column_binding.hpp"
 
 namespace duckdb {
+class BlockedBloomFilter;
 class DataChunk;
 class DynamicTableFilterSet;
+class JoinHashTable;
 struct GlobalUngroupedAggregateState;
 struct LocalUngroupedAggregateState;
 
@@ -30,6 +32,8 @@ struct JoinFilterGlobalState {
 
 	//! Global Min/Max aggregates for filter pushdown
 	unique_ptr<GlobalUngroupedAggregateState> global_aggregate_state;
+	//! Whether or not the pushed filters exactly match the build side keys (i.e. they are equality or IN filters)
+	bool exact_filters = false;
 };
 
 struct JoinFilterLocalState {
@@ -47,13 +51,25 @@ struct JoinFilterPushdownInfo {
 	//! Min/Max aggregates
 	vector<unique_ptr<Expression>> min_max_aggregates;
 
+	//! The maximum build side size for which we try to push the distinct build side keys as an IN filter
+	static constexpr const idx_t IN_FILTER_MAX_BUILD_SIZE = 16384;
+	//! The maximum number of distinct values in a pushed IN filter
+	static constexpr const idx_t IN_FILTER_MAX_VALUES = 512;
+	//! The maximum build side size for which we generate a bloom filter
+	static constexpr const idx_t BLOOM_FILTER_MAX_BUILD_SIZE = 4194304;
+
 public:
 	unique_ptr<JoinFilterGlobalState> GetGlobalState(ClientContext &context, const PhysicalOperator &op) const;
 	unique_ptr<JoinFilterLocalState> GetLocalState(JoinFilterGlobalState &gstate) const;
 
 	void Sink(DataChunk &chunk, JoinFilterLocalState &lstate) const;
 	void Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const;
-	void PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const;
+	void PushFilters(JoinHashTable &ht, JoinFilterGlobalState &gstate, const PhysicalOperator &op) const;
+
+	//! Creates an (empty) bloom filter for the build side of the hash table, if a bloom filter can be pushed
+	shared_ptr<BlockedBloomFilter> CreateBloomFilter(JoinFilterGlobalState &gstate, const JoinHashTable &ht) const;
+	//! Push a (filled) bloom filter into the probe side
+	void PushBloomFilter(const PhysicalOperator &op, shared_ptr<BlockedBloomFilter> bloom_filter) const;
 };
 
 } // namespace duckdb
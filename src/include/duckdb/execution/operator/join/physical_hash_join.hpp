@@ -52,6 +52,8 @@ public:
 	vector<LogicalType> delim_types;
 	//! Used in perfect hash join
 	PerfectHashJoinStats perfect_join_statistics;
+	//! Whether the build keys are known to be unique (e.g., a primary key), set by the PhysicalPlanGenerator
+	bool build_keys_unique = false;
 
 public:
 	InsertionOrderPreservingMap<string> ParamsToString() const override;
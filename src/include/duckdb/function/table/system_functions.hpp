@@ -41,6 +41,14 @@ struct PragmaDatabaseSize {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct PragmaDatabaseLoadInfo {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
+struct PragmaIndexMemoryInfo {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct DuckDBSchemasFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
@@ -124,6 +124,12 @@ struct DBConfigOptions {
 	AccessMode access_mode = AccessMode::AUTOMATIC;
 	//! Checkpoint when WAL reaches this size (default: 16MB)
 	idx_t checkpoint_wal_size = 1 << 24;
+	//! Whether automatic checkpoints run on a background thread instead of on the committing thread
+	bool background_checkpoint = false;
+	//! Whether commits sync the WAL after releasing the WAL lock, so concurrent commits share a single sync
+	bool wal_group_commit = false;
+	//! Sync the WAL at most once per this many milliseconds (0 = sync on every commit)
+	idx_t wal_sync_interval = 0;
 	//! Whether or not to use Direct IO, bypassing operating system buffers
 	bool use_direct_io = false;
 	//! Whether extensions should be loaded on start-up
@@ -248,6 +254,8 @@ struct DBConfigOptions {
 	idx_t allocator_bulk_deallocation_flush_threshold = 536870912ULL;
 	//! Whether the allocator background thread is enabled
 	bool allocator_background_threads = false;
+	//! Whether the background threads are pinned to the CPUs of a NUMA node
+	bool thread_pinning = false;
 	//! DuckDB API surface
 	string duckdb_api;
 	//! Metadata from DuckDB callers
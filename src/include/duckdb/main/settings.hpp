@@ -81,6 +81,17 @@ struct CatalogErrorMaxSchema {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct BackgroundCheckpointSetting {
+	static constexpr const char *Name = "background_checkpoint";
+	static constexpr const char *Description =
+	    "Run automatic checkpoints on a background thread instead of on the thread that commits (transactions that "
+	    "write still wait for a running checkpoint)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct CheckpointThresholdSetting {
 	static constexpr const char *Name = "checkpoint_threshold";
 	static constexpr const char *Description =
@@ -91,6 +102,27 @@ struct CheckpointThresholdSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct WALGroupCommitSetting {
+	static constexpr const char *Name = "wal_group_commit";
+	static constexpr const char *Description =
+	    "Sync the WAL after releasing the WAL lock, so concurrent commits can share a single sync";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct WALSyncIntervalSetting {
+	static constexpr const char *Name = "wal_sync_interval";
+	static constexpr const char *Description =
+	    "Relaxed durability: sync the WAL at most once per this many milliseconds, in the background if no commit "
+	    "does (0 syncs on every commit)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DebugCheckpointAbort {
 	static constexpr const char *Name = "debug_checkpoint_abort";
 	static constexpr const char *Description =
@@ -917,6 +949,16 @@ struct AllocatorBackgroundThreadsSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct ThreadPinningSetting {
+	static constexpr const char *Name = "thread_pinning";
+	static constexpr const char *Description =
+	    "Whether to pin each background thread to the CPUs of one NUMA node (no effect on single-node systems).";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DuckDBApiSetting {
 	static constexpr const char *Name = "duckdb_api";
 	static constexpr const char *Description = "DuckDB API surface";
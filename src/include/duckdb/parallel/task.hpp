@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/optional_idx.hpp"
 
 namespace duckdb {
 class ClientContext;
@@ -50,6 +51,12 @@ public:
 	virtual bool TaskBlockedOnResult() const {
 		return false;
 	}
+
+public:
+	//! The scheduler worker thread that last executed this task before it was descheduled (if any)
+	//! When the task is rescheduled it is preferably placed in the local queue of this worker, as the caches of
+	//! that thread still hold the state of the task
+	optional_idx affinity;
 };
 
 } // namespace duckdb
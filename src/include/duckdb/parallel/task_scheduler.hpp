@@ -23,6 +23,7 @@ class DatabaseInstance;
 class TaskScheduler;
 
 struct SchedulerThread;
+struct WorkerTaskQueue;
 
 struct ProducerToken {
 	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token);
@@ -37,6 +38,8 @@ struct ProducerToken {
 class TaskScheduler {
 	// timeout for semaphore wait, default 5ms
 	constexpr static int64_t TASK_TIMEOUT_USECS = 5000;
+	//! The maximum number of worker threads that get a local task queue, additional threads only use the global queue
+	constexpr static idx_t MAX_WORKER_QUEUES = 256;
 
 public:
 	explicit TaskScheduler(DatabaseInstance &db);
@@ -51,7 +54,8 @@ public:
 	//! Fetches a task from a specific producer, returns true if successful or false if no tasks were available
 	bool GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task);
 	//! Run tasks forever until "marker" is set to false, "marker" must remain valid until the thread is joined
-	void ExecuteForever(atomic<bool> *marker);
+	//! If "worker_id" is set, the thread first runs tasks from its own local queue
+	void ExecuteForever(atomic<bool> *marker, optional_idx worker_id = optional_idx());
 	//! Run tasks until `marker` is set to false, `max_tasks` have been completed, or until there are no more tasks
 	//! available. Returns the number of tasks that were completed.
 	idx_t ExecuteTasks(atomic<bool> *marker, idx_t max_tasks);
@@ -86,6 +90,13 @@ public:
 
 private:
 	void RelaunchThreadsInternal(int32_t n);
+	//! Fetches a task for a (worker) thread: first from the local queue of the worker, then from the global queue,
+	//! and finally by stealing from the local queues of the other workers
+	bool DequeueTask(optional_idx worker_id, shared_ptr<Task> &task);
+	//! Steals a task from the local queue of another worker - optionally only from workers on the given NUMA node
+	bool StealTask(optional_idx worker_id, idx_t queue_count, optional_idx numa_node, shared_ptr<Task> &task);
+	//! Moves all tasks in the local queue of a stopped worker back into the global queue
+	void DrainWorkerQueue(WorkerTaskQueue &worker_queue);
 
 private:
 	DatabaseInstance &db;
@@ -97,6 +108,16 @@ private:
 	vector<unique_ptr<SchedulerThread>> threads;
 	//! Markers used by the various threads, if the markers are set to "false" the thread execution is stopped
 	vector<unique_ptr<atomic<bool>>> markers;
+	//! The local task queues of the background threads - these are never removed, so they can be read concurrently
+	vector<unique_ptr<WorkerTaskQueue>> worker_queues;
+	//! The number of entries of "worker_queues" that are safe to read
+	atomic<idx_t> worker_queue_count;
+	//! The local queue that the next newly scheduled task is placed in
+	atomic<idx_t> next_worker_queue;
+	//! The CPUs of every NUMA node (only loaded when thread pinning is enabled)
+	vector<vector<idx_t>> numa_node_cpus;
+	//! Whether the background threads are currently pinned to the CPUs of a NUMA node
+	atomic<bool> pinned_threads;
 	//! The threshold after which to flush the allocator after completing a task
 	atomic<idx_t> allocator_flush_threshold;
 	//! Whether allocator background threads are enabled
@@ -0,0 +1,42 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types/blocked_bloom_filter.hpp"
+
+namespace duckdb {
+
+//! BloomFilter is a runtime filter generated from the build side of a hash join
+//! It filters out rows whose hash is not in the filter - this is approximate (false positives are possible),
+//! the join still evaluates the exact join condition on all rows that pass
+class BloomFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::BLOOM_FILTER;
+
+public:
+	explicit BloomFilter(shared_ptr<BlockedBloomFilter> filter);
+
+	//! The filter (shared between all copies of this table filter)
+	shared_ptr<BlockedBloomFilter> filter;
+
+public:
+	//! Filter the selected rows of the vector, keeping only (non-NULL) rows whose hash might be in the filter
+	idx_t Filter(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t &approved_tuple_count) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
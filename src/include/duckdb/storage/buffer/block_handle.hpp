@@ -62,6 +62,7 @@ class BlockHandle : public enable_shared_from_this<BlockHandle> {
 	friend class StandardBufferManager;
 	friend class BufferPool;
 	friend struct EvictionQueue;
+	friend struct EvictionQueueShard;
 
 public:
 	BlockHandle(BlockManager &block_manager, block_id_t block_id, MemoryTag tag);
@@ -141,6 +142,10 @@ private:
 	unique_ptr<FileBuffer> buffer;
 	//! Internal eviction sequence number
 	atomic<idx_t> eviction_seq_num;
+	//! Whether or not the block has a node in the eviction queue (protected by the block lock)
+	bool eviction_queued;
+	//! Whether the block was used again while it was in the eviction queue (protected by the block lock)
+	bool eviction_referenced;
 	//! LRU timestamp (for age-based eviction)
 	atomic<int64_t> lru_timestamp_msec;
 	//! When to destroy the data buffer
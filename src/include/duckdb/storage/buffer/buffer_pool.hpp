@@ -83,13 +83,13 @@ protected:
 	idx_t PurgeAgedBlocksInternal(EvictionQueue &queue, uint32_t max_age_sec, int64_t now, int64_t limit);
 	//! Garbage collect dead nodes in the eviction queue.
 	void PurgeQueue(FileBufferType type);
-	//! Add a buffer handle to the eviction queue. Returns true, if the queue is
-	//! ready to be purged, and false otherwise.
+	//! Add a buffer handle to the eviction queue - or mark it as referenced if it is still in the queue.
+	//! Returns true, if the queue is ready to be purged, and false otherwise.
 	bool AddToEvictionQueue(shared_ptr<BlockHandle> &handle);
 	//! Gets the eviction queue for the specified type
 	EvictionQueue &GetEvictionQueueForType(FileBufferType type);
-	//! Increments the dead nodes for the queue with specified type
-	void IncrementDeadNodes(FileBufferType type);
+	//! Increments the dead nodes for the queue (shard) of the specified block handle
+	void IncrementDeadNodes(const BlockHandle &handle);
 
 protected:
 	enum class MemoryUsageCaches {
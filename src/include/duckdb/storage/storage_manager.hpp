@@ -57,6 +57,22 @@ struct CheckpointOptions {
 	CheckpointType type;
 };
 
+//! Timings of loading a database from disk
+struct StorageLoadInfo {
+	//! The time spent loading the checkpointed database file (in seconds)
+	double checkpoint_load_time = 0;
+	//! The time spent scanning the WAL for a checkpoint marker (in seconds)
+	double wal_scan_time = 0;
+	//! The time spent replaying the WAL (in seconds)
+	double wal_replay_time = 0;
+	//! The size of the WAL (in bytes)
+	idx_t wal_size = 0;
+	//! The number of replayed WAL entries
+	idx_t wal_entries = 0;
+	//! The number of replayed WAL transactions
+	idx_t wal_transactions = 0;
+};
+
 //! StorageManager is responsible for managing the physical storage of the
 //! database on disk
 class StorageManager {
@@ -92,6 +108,10 @@ public:
 	bool IsLoaded() const {
 		return load_complete;
 	}
+	//! Timings of loading the database from disk
+	StorageLoadInfo &GetLoadInfo() {
+		return load_info;
+	}
 	//! The path to the WAL, derived from the database file path
 	string GetWALPath();
 	bool InMemory();
@@ -120,6 +140,8 @@ protected:
 	//! When loading a database, we do not yet set the wal-field. Therefore, GetWriteAheadLog must
 	//! return nullptr when loading a database
 	bool load_complete = false;
+	//! Timings of loading the database from disk
+	StorageLoadInfo load_info;
 
 public:
 	template <class TARGET>
@@ -53,7 +53,7 @@ struct RowGroupAppendState {
 };
 
 struct IndexLock {
-	unique_lock<mutex> index_lock;
+	unique_ptr<StorageLockKey> index_lock;
 };
 
 struct TableAppendState {
@@ -87,6 +87,9 @@ struct LocalAppendState {
 	TableAppendState append_state;
 	LocalTableStorage *storage;
 	unique_ptr<ConstraintState> constraint_state;
+	//! Whether to skip appending to the transaction-local indexes. The rows are still appended to the indexes of the
+	//! table on commit, but constraint violations are only detected at that point (used for WAL replay)
+	bool skip_local_indexes = false;
 };
 
 } // namespace duckdb
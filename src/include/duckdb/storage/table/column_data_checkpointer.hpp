@@ -16,6 +16,10 @@ namespace duckdb {
 struct TableScanOptions;
 
 class ColumnDataCheckpointer {
+public:
+	//! Unchanged persistent segments with fewer rows than this are rewritten if they border on a changed segment
+	static constexpr const idx_t MINIMUM_PERSISTENT_SEGMENT_COUNT = STANDARD_VECTOR_SIZE;
+
 public:
 	ColumnDataCheckpointer(ColumnData &col_data_p, RowGroup &row_group_p, ColumnCheckpointState &state_p,
 	                       ColumnCheckpointInfo &checkpoint_info);
@@ -23,6 +27,8 @@ public:
 public:
 	DatabaseInstance &GetDatabase();
 	const LogicalType &GetType() const;
+	//! The first row of the segments that are currently being rewritten
+	idx_t GetRowStart() const;
 	ColumnData &GetColumnData();
 	RowGroup &GetRowGroup();
 	ColumnCheckpointState &GetCheckpointState();
@@ -34,8 +40,8 @@ private:
 	void ScanSegments(const std::function<void(Vector &, idx_t)> &callback);
 	unique_ptr<AnalyzeState> DetectBestCompressionMethod(idx_t &compression_idx);
 	void WriteToDisk();
-	bool HasChanges();
-	void WritePersistentSegments();
+	bool HasChanges(ColumnSegment &segment);
+	void WritePersistentSegment(unique_ptr<ColumnSegment> segment);
 
 private:
 	ColumnData &col_data;
@@ -41,6 +41,8 @@ public:
 
 	idx_t DeleteRows(idx_t vector_idx, transaction_t transaction_id, row_t rows[], idx_t count);
 	void CommitDelete(idx_t vector_idx, transaction_t commit_id, const DeleteInfo &info);
+	//! Compacts the version info of a vector once its deletes are visible to all transactions
+	void CleanupDelete(transaction_t lowest_active_transaction, idx_t vector_idx);
 
 	vector<MetaBlockPointer> Checkpoint(MetadataManager &manager);
 	static shared_ptr<RowVersionManager> Deserialize(MetaBlockPointer delete_pointer, MetadataManager &manager,
@@ -56,6 +58,7 @@ private:
 private:
 	optional_ptr<ChunkInfo> GetChunkInfo(idx_t vector_idx);
 	ChunkVectorInfo &GetVectorInfo(idx_t vector_idx);
+	void CleanupVectorInfo(transaction_t lowest_active_transaction, idx_t vector_idx);
 };
 
 } // namespace duckdb
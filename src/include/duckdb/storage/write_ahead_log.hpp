@@ -12,14 +12,19 @@
 #include "duckdb/catalog/catalog_entry/scalar_macro_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/sequence_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_macro_catalog_entry.hpp"
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/common/enums/wal_type.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
+#include "duckdb/common/thread.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/storage/block.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 struct AlterInfo;
@@ -112,7 +117,16 @@ public:
 	void Truncate(idx_t size);
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
-	void Flush();
+	//! Write a flush marker to the WAL. If sync is true, the WAL is also synced to disk; otherwise the data is only
+	//! handed to the OS and the caller is responsible for calling SyncCommit later on
+	void Flush(bool sync = true);
+	//! Whether or not commits should defer syncing the WAL until after the WAL lock is released (group commit)
+	bool DeferCommitSync();
+	//! Make sure the WAL is synced to disk up to (at least) the given size. Concurrent commits that wrote to the WAL
+	//! while another commit was syncing are all made durable by a single sync. With a sync interval the sync can be
+	//! left to the background flusher, which syncs the WAL at the latest one interval later.
+	//! Once a sync has failed, every subsequent call throws: data written after the failed sync cannot be made durable
+	void SyncCommit(idx_t size);
 
 	void WriteCheckpoint(MetaBlockPointer meta_block);
 
@@ -123,6 +137,28 @@ protected:
 	string wal_path;
 	atomic<idx_t> wal_size;
 	atomic<bool> initialized;
+	//! Lock held while syncing the WAL to disk
+	mutex sync_lock;
+	//! The WAL size up to which the WAL is known to be synced to disk
+	idx_t synced_size;
+	//! The time of the last sync (used for the relaxed durability mode)
+	time_point<steady_clock> last_sync;
+	//! The error of a failed sync - if set, the WAL can no longer be synced
+	string sync_error;
+	//! The background flusher that syncs deferred commits in the relaxed durability mode
+	unique_ptr<thread> flusher;
+	//! Signals the flusher to stop
+	std::condition_variable flusher_cv;
+	bool stop_flusher = false;
+
+private:
+	//! Sync everything written to the WAL so far - requires the sync lock to be held
+	void SyncInternal();
+	//! Start the background flusher if it is not running yet - requires the sync lock to be held
+	void StartFlusher();
+	void RunFlusher();
+	//! Stop the background flusher and sync whatever it has not synced yet
+	void StopFlusher();
 };
 
 } // namespace duckdb
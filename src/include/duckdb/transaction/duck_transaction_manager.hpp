@@ -14,6 +14,7 @@
 
 namespace duckdb {
 class DuckTransaction;
+struct BackgroundCheckpointState;
 
 //! The Transaction Manager is responsible for creating and managing
 //! transactions
@@ -33,6 +34,10 @@ public:
 	void RollbackTransaction(Transaction &transaction) override;
 
 	void Checkpoint(ClientContext &context, bool force = false) override;
+	//! Run an automatic checkpoint that was scheduled in the background
+	void BackgroundCheckpoint();
+	//! Stop scheduling background checkpoints and wait for a running background checkpoint to finish
+	void StopBackgroundCheckpoints();
 
 	transaction_t LowestActiveId() const {
 		return lowest_active_id;
@@ -67,6 +72,8 @@ protected:
 		bool can_checkpoint;
 		string reason;
 		CheckpointType type;
+		//! Whether the checkpoint is scheduled on a background thread instead
+		bool in_background = false;
 	};
 
 private:
@@ -80,6 +87,11 @@ private:
 	//! Whether or not we can checkpoint
 	CheckpointDecision CanCheckpoint(DuckTransaction &transaction, unique_ptr<StorageLockKey> &checkpoint_lock,
 	                                 const UndoBufferProperties &properties);
+	//! Schedule an automatic checkpoint on a background thread (if none is scheduled yet)
+	//! Throws the error of the previous background checkpoint if it failed
+	void ScheduleBackgroundCheckpoint();
+	//! The type of checkpoint that can run given the currently active transactions
+	CheckpointType GetCheckpointType();
 
 private:
 	//! The current start timestamp used by transactions
@@ -109,6 +121,8 @@ private:
 
 	atomic<idx_t> last_uncommitted_catalog_version = {TRANSACTION_ID_START};
 	idx_t last_committed_version = 0;
+	//! The state of the automatic checkpoints running in the background
+	shared_ptr<BackgroundCheckpointState> background_checkpoint;
 
 protected:
 	virtual void OnCommitCheckpointDecision(const CheckpointDecision &decision, DuckTransaction &transaction) {
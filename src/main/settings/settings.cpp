@@ -95,6 +95,22 @@ Value CatalogErrorMaxSchema::GetSetting(const ClientContext &context) {
 	return Value::UBIGINT(config.options.catalog_error_max_schemas);
 }
 
+//===--------------------------------------------------------------------===//
+// Background Checkpoint
+//===--------------------------------------------------------------------===//
+void BackgroundCheckpointSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.background_checkpoint = input.GetValue<bool>();
+}
+
+void BackgroundCheckpointSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.background_checkpoint = DBConfig().options.background_checkpoint;
+}
+
+Value BackgroundCheckpointSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.background_checkpoint);
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint Threshold
 //===--------------------------------------------------------------------===//
@@ -112,6 +128,38 @@ Value CheckpointThresholdSetting::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.checkpoint_wal_size));
 }
 
+//===--------------------------------------------------------------------===//
+// WAL Group Commit
+//===--------------------------------------------------------------------===//
+void WALGroupCommitSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.wal_group_commit = input.GetValue<bool>();
+}
+
+void WALGroupCommitSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_group_commit = DBConfig().options.wal_group_commit;
+}
+
+Value WALGroupCommitSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.wal_group_commit);
+}
+
+//===--------------------------------------------------------------------===//
+// WAL Sync Interval
+//===--------------------------------------------------------------------===//
+void WALSyncIntervalSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.wal_sync_interval = input.GetValue<uint64_t>();
+}
+
+void WALSyncIntervalSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_sync_interval = DBConfig().options.wal_sync_interval;
+}
+
+Value WALSyncIntervalSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.wal_sync_interval);
+}
+
 //===--------------------------------------------------------------------===//
 // Debug Checkpoint Abort
 //===--------------------------------------------------------------------===//
@@ -1974,6 +2022,23 @@ Value AllocatorBackgroundThreadsSetting::GetSetting(const ClientContext &context
 	return Value(config.options.allocator_background_threads);
 }
 
+//===--------------------------------------------------------------------===//
+// Thread Pinning
+//===--------------------------------------------------------------------===//
+void ThreadPinningSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	// the background threads are relaunched with the new setting when the next query starts
+	config.options.thread_pinning = input.GetValue<bool>();
+}
+
+void ThreadPinningSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.thread_pinning = DBConfig().options.thread_pinning;
+}
+
+Value ThreadPinningSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(config.options.thread_pinning);
+}
+
 //===--------------------------------------------------------------------===//
 // DuckDBApi Setting
 //===--------------------------------------------------------------------===//
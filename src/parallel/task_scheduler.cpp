@@ -1,7 +1,9 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 
 #include "duckdb/common/chrono.hpp"
+#include "duckdb/common/deque.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/numa.hpp"
 #include "duckdb/common/numeric_utils.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
@@ -23,6 +25,11 @@
 #include <unistd.h>
 #endif
 
+#if defined(__linux__) && defined(_GNU_SOURCE) && !defined(DUCKDB_WASM) && !defined(DUCKDB_NO_THREADS)
+#define DUCKDB_THREAD_AFFINITY
+#include <pthread.h>
+#endif
+
 namespace duckdb {
 
 struct SchedulerThread {
@@ -67,6 +74,87 @@ bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task>
 	return q.try_dequeue_from_producer(token.token->queue_token, task);
 }
 
+//! The local task queue of a background worker thread
+//! The owning worker pops tasks from the back (most recently scheduled, warmest caches first), while other threads
+//! steal tasks from the front
+struct WorkerTaskQueue {
+	struct QueuedTask {
+		QueuedTask(ProducerToken &token, shared_ptr<Task> task_p) : token(token), task(std::move(task_p)) {
+		}
+
+		reference<ProducerToken> token;
+		shared_ptr<Task> task;
+	};
+
+	mutex lock;
+	//! Whether or not the worker owning this queue is running - tasks can only be added to active queues
+	bool active = false;
+	//! The NUMA node the worker is pinned to (0 if the threads are not pinned)
+	atomic<idx_t> numa_node {0};
+	deque<QueuedTask> tasks;
+	//! The number of tasks in the queue, used to skip empty queues without locking them
+	atomic<idx_t> task_count {0};
+
+	bool Enqueue(ProducerToken &token, shared_ptr<Task> &task);
+	bool PopBack(shared_ptr<Task> &task);
+	bool PopFront(shared_ptr<Task> &task);
+	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
+};
+
+bool WorkerTaskQueue::Enqueue(ProducerToken &token, shared_ptr<Task> &task) {
+	lock_guard<mutex> guard(lock);
+	if (!active) {
+		return false;
+	}
+	tasks.emplace_back(token, std::move(task));
+	task_count++;
+	return true;
+}
+
+bool WorkerTaskQueue::PopBack(shared_ptr<Task> &task) {
+	if (task_count == 0) {
+		return false;
+	}
+	lock_guard<mutex> guard(lock);
+	if (tasks.empty()) {
+		return false;
+	}
+	task = std::move(tasks.back().task);
+	tasks.pop_back();
+	task_count--;
+	return true;
+}
+
+bool WorkerTaskQueue::PopFront(shared_ptr<Task> &task) {
+	if (task_count == 0) {
+		return false;
+	}
+	lock_guard<mutex> guard(lock);
+	if (tasks.empty()) {
+		return false;
+	}
+	task = std::move(tasks.front().task);
+	tasks.pop_front();
+	task_count--;
+	return true;
+}
+
+bool WorkerTaskQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
+	if (task_count == 0) {
+		return false;
+	}
+	lock_guard<mutex> guard(lock);
+	for (auto it = tasks.begin(); it != tasks.end(); it++) {
+		if (RefersToSameObject(it->token.get(), token)) {
+			task = std::move(it->task);
+			tasks.erase(it);
+			task_count--;
+			return true;
+		}
+	}
+	return false;
+}
+
 #else
 struct ConcurrentQueue {
 	reference_map_t<QueueProducerToken, std::queue<shared_ptr<Task>>> q;
@@ -108,6 +196,8 @@ struct QueueProducerToken {
 private:
 	ConcurrentQueue *queue;
 };
+
+struct WorkerTaskQueue {};
 #endif
 
 ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token)
@@ -121,7 +211,9 @@ TaskScheduler::TaskScheduler(DatabaseInstance &db)
     : db(db), queue(make_uniq<ConcurrentQueue>()),
       allocator_flush_threshold(db.config.options.allocator_flush_threshold),
       allocator_background_threads(db.config.options.allocator_background_threads), requested_thread_count(0),
-      current_thread_count(1) {
+      current_thread_count(1), worker_queue_count(0), next_worker_queue(0), pinned_threads(false) {
+	// reserve the worker queues up-front: the vector is never reallocated, so it can be read while threads are added
+	worker_queues.reserve(MAX_WORKER_QUEUES);
 	SetAllocatorBackgroundThreads(db.config.options.allocator_background_threads);
 }
 
@@ -149,15 +241,108 @@ unique_ptr<ProducerToken> TaskScheduler::CreateProducer() {
 }
 
 void TaskScheduler::ScheduleTask(ProducerToken &token, shared_ptr<Task> task) {
+#ifndef DUCKDB_NO_THREADS
+	auto queue_count = worker_queue_count.load();
+	if (queue_count > 0) {
+		idx_t worker_id;
+		if (task->affinity.IsValid()) {
+			// the task ran on a worker before - try to schedule it in the local queue of that worker
+			worker_id = task->affinity.GetIndex();
+		} else {
+			// new tasks are spread over the local queues round-robin, idle workers steal them from the other queues
+			worker_id = next_worker_queue++ % queue_count;
+		}
+		if (worker_id < queue_count && worker_queues[worker_id]->Enqueue(token, task)) {
+			// signal any sleeping threads - if the worker is busy, another thread can steal the task
+			queue->semaphore.signal();
+			return;
+		}
+	}
+#endif
 	// Enqueue a task for the given producer token and signal any sleeping threads
 	queue->Enqueue(token, std::move(task));
 }
 
 bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
-	return queue->DequeueFromProducer(token, task);
+	if (queue->DequeueFromProducer(token, task)) {
+		return true;
+	}
+#ifndef DUCKDB_NO_THREADS
+	// the task might have been scheduled in the local queue of a worker
+	auto queue_count = worker_queue_count.load();
+	for (idx_t i = 0; i < queue_count; i++) {
+		if (worker_queues[i]->DequeueFromProducer(token, task)) {
+			return true;
+		}
+	}
+#endif
+	return false;
+}
+
+bool TaskScheduler::DequeueTask(optional_idx worker_id, shared_ptr<Task> &task) {
+#ifndef DUCKDB_NO_THREADS
+	auto queue_count = worker_queue_count.load();
+	if (worker_id.IsValid() && worker_id.GetIndex() < queue_count) {
+		if (worker_queues[worker_id.GetIndex()]->PopBack(task)) {
+			return true;
+		}
+	}
+	if (queue->q.try_dequeue(task)) {
+		return true;
+	}
+	// no tasks in the global queue: try to steal a task from another worker
+	if (pinned_threads && worker_id.IsValid() && worker_id.GetIndex() < queue_count) {
+		// the threads are pinned: prefer stealing from workers on the same node, which share its caches
+		auto numa_node = worker_queues[worker_id.GetIndex()]->numa_node.load();
+		if (StealTask(worker_id, queue_count, numa_node, task)) {
+			return true;
+		}
+	}
+	return StealTask(worker_id, queue_count, optional_idx(), task);
+#else
+	throw NotImplementedException("DuckDB was compiled without threads! Background thread loop is not allowed.");
+#endif
+}
+
+bool TaskScheduler::StealTask(optional_idx worker_id, idx_t queue_count, optional_idx numa_node,
+                              shared_ptr<Task> &task) {
+#ifndef DUCKDB_NO_THREADS
+	// start at the next worker so that not all threads try to steal from the same queue
+	idx_t offset = worker_id.IsValid() ? worker_id.GetIndex() + 1 : 0;
+	for (idx_t i = 0; i < queue_count; i++) {
+		auto steal_id = (offset + i) % queue_count;
+		if (worker_id.IsValid() && steal_id == worker_id.GetIndex()) {
+			continue;
+		}
+		auto &worker_queue = *worker_queues[steal_id];
+		if (numa_node.IsValid() && worker_queue.numa_node != numa_node.GetIndex()) {
+			continue;
+		}
+		if (worker_queue.PopFront(task)) {
+			return true;
+		}
+	}
+#endif
+	return false;
+}
+
+void TaskScheduler::DrainWorkerQueue(WorkerTaskQueue &worker_queue) {
+#ifndef DUCKDB_NO_THREADS
+	deque<WorkerTaskQueue::QueuedTask> remaining_tasks;
+	{
+		lock_guard<mutex> guard(worker_queue.lock);
+		worker_queue.active = false;
+		remaining_tasks = std::move(worker_queue.tasks);
+		worker_queue.tasks.clear();
+		worker_queue.task_count = 0;
+	}
+	for (auto &entry : remaining_tasks) {
+		queue->Enqueue(entry.token, std::move(entry.task));
+	}
+#endif
 }
 
-void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
+void TaskScheduler::ExecuteForever(atomic<bool> *marker, optional_idx worker_id) {
 #ifndef DUCKDB_NO_THREADS
 	static constexpr const int64_t INITIAL_FLUSH_WAIT = 500000; // initial wait time of 0.5s (in mus) before flushing
 
@@ -185,7 +370,7 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 				}
 			}
 		}
-		if (queue->q.try_dequeue(task)) {
+		if (DequeueTask(worker_id, task)) {
 			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
 
 			switch (execute_result) {
@@ -196,6 +381,8 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 			case TaskExecutionResult::TASK_NOT_FINISHED:
 				throw InternalException("Task should not return TASK_NOT_FINISHED in PROCESS_ALL mode");
 			case TaskExecutionResult::TASK_BLOCKED:
+				// remember this worker: when the task is rescheduled it is preferably placed in our local queue
+				task->affinity = worker_id;
 				task->Deschedule();
 				task.reset();
 				break;
@@ -218,7 +405,7 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
 		shared_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		if (!DequeueTask(optional_idx(), task)) {
 			return completed_tasks;
 		}
 		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
@@ -248,7 +435,7 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 	shared_ptr<Task> task;
 	for (idx_t i = 0; i < max_tasks; i++) {
 		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		if (!DequeueTask(optional_idx(), task)) {
 			return;
 		}
 		try {
@@ -275,8 +462,22 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 }
 
 #ifndef DUCKDB_NO_THREADS
-static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker) {
-	scheduler->ExecuteForever(marker);
+static void PinThreadToCPUs(thread &worker_thread, const vector<idx_t> &cpus) {
+#ifdef DUCKDB_THREAD_AFFINITY
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	for (auto &cpu : cpus) {
+		if (cpu < CPU_SETSIZE) {
+			CPU_SET(cpu, &cpu_set);
+		}
+	}
+	// this is best-effort: if it fails (e.g. because the CPUs are not in our cpuset) the thread is not pinned
+	pthread_setaffinity_np(worker_thread.native_handle(), sizeof(cpu_set), &cpu_set);
+#endif
+}
+
+static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker, optional_idx worker_id) {
+	scheduler->ExecuteForever(marker, worker_id);
 }
 #endif
 
@@ -370,12 +571,13 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 #ifndef DUCKDB_NO_THREADS
 	auto &config = DBConfig::GetConfig(db);
 	auto new_thread_count = NumericCast<idx_t>(n);
-	if (threads.size() == new_thread_count) {
+	auto thread_pinning = config.options.thread_pinning;
+	if (threads.size() == new_thread_count && thread_pinning == pinned_threads) {
 		current_thread_count = NumericCast<int32_t>(threads.size() + config.options.external_threads);
 		return;
 	}
-	if (threads.size() > new_thread_count) {
-		// we are reducing the number of threads: clear all threads first
+	if (threads.size() > new_thread_count || thread_pinning != pinned_threads) {
+		// we are reducing the number of threads or changing their placement: clear all threads first
 		for (idx_t i = 0; i < threads.size(); i++) {
 			*markers[i] = false;
 		}
@@ -384,30 +586,61 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 		for (idx_t i = 0; i < threads.size(); i++) {
 			threads[i]->internal_thread->join();
 		}
+		// move any tasks left in the local queues of the stopped threads back into the global queue
+		for (idx_t i = 0; i < worker_queue_count; i++) {
+			DrainWorkerQueue(*worker_queues[i]);
+		}
 		// erase the threads/markers
 		threads.clear();
 		markers.clear();
 	}
 	if (threads.size() < new_thread_count) {
 		// we are increasing the number of threads: launch them and run tasks on them
+		if (thread_pinning && numa_node_cpus.empty()) {
+			auto fs = FileSystem::CreateLocal();
+			numa_node_cpus = NUMA::GetNodeCPUs(*fs);
+		}
+		// only pin the threads if there are multiple NUMA nodes
+		auto pin_threads = thread_pinning && numa_node_cpus.size() > 1;
 		idx_t create_new_threads = new_thread_count - threads.size();
 		for (idx_t i = 0; i < create_new_threads; i++) {
 			// launch a thread and assign it a cancellation marker
 			auto marker = unique_ptr<atomic<bool>>(new atomic<bool>(true));
+			// the first MAX_WORKER_QUEUES threads get a local task queue
+			optional_idx worker_id;
+			auto thread_idx = threads.size();
+			if (thread_idx < MAX_WORKER_QUEUES) {
+				if (thread_idx == worker_queues.size()) {
+					worker_queues.push_back(make_uniq<WorkerTaskQueue>());
+					worker_queue_count = worker_queues.size();
+				}
+				lock_guard<mutex> guard(worker_queues[thread_idx]->lock);
+				worker_queues[thread_idx]->active = true;
+				worker_queues[thread_idx]->numa_node = pin_threads ? thread_idx % numa_node_cpus.size() : 0;
+				worker_id = thread_idx;
+			}
 			unique_ptr<thread> worker_thread;
 			try {
-				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get());
+				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get(), worker_id);
 			} catch (std::exception &ex) {
 				// thread constructor failed - this can happen when the system has too many threads allocated
 				// in this case we cannot allocate more threads - stop launching them
+				if (worker_id.IsValid()) {
+					DrainWorkerQueue(*worker_queues[worker_id.GetIndex()]);
+				}
 				break;
 			}
+			if (pin_threads) {
+				// spread the threads over the NUMA nodes round-robin
+				PinThreadToCPUs(*worker_thread, numa_node_cpus[threads.size() % numa_node_cpus.size()]);
+			}
 			auto thread_wrapper = make_uniq<SchedulerThread>(std::move(worker_thread));
 
 			threads.push_back(std::move(thread_wrapper));
 			markers.push_back(std::move(marker));
 		}
 	}
+	pinned_threads = thread_pinning;
 	current_thread_count = NumericCast<int32_t>(threads.size() + config.options.external_threads);
 	if (Allocator::SupportsFlush()) {
 		Allocator::FlushAll();
@@ -0,0 +1,82 @@
+#include "duckdb/planner/filter/bloom_filter.hpp"
+
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+
+namespace duckdb {
+
+BloomFilter::BloomFilter(shared_ptr<BlockedBloomFilter> filter_p)
+    : TableFilter(TableFilterType::BLOOM_FILTER), filter(std::move(filter_p)) {
+	D_ASSERT(filter);
+}
+
+idx_t BloomFilter::Filter(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel,
+                          idx_t &approved_tuple_count) const {
+	if (approved_tuple_count == 0) {
+		return 0;
+	}
+	// hash the selected rows - the hashes are written to the same position as the selected rows
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(vector, hashes, sel, approved_tuple_count);
+	UnifiedVectorFormat hash_data;
+	hashes.ToUnifiedFormat(STANDARD_VECTOR_SIZE, hash_data);
+	auto hash_ptr = UnifiedVectorFormat::GetData<hash_t>(hash_data);
+
+	SelectionVector result_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		if (!vdata.validity.RowIsValid(vdata.sel->get_index(idx))) {
+			// NULL values never match an equality join condition
+			continue;
+		}
+		if (filter->Lookup(hash_ptr[hash_data.sel->get_index(idx)])) {
+			result_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(result_sel);
+	approved_tuple_count = result_count;
+	return result_count;
+}
+
+FilterPropagateResult BloomFilter::CheckStatistics(BaseStatistics &stats) {
+	// the filter is defined over hashes - we cannot prune anything based on min/max statistics
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+string BloomFilter::ToString(const string &column_name) {
+	return column_name + " IN BLOOM_FILTER(" + to_string(filter->BlockCount()) + " blocks)";
+}
+
+bool BloomFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<BloomFilter>();
+	return other.filter.get() == filter.get();
+}
+
+unique_ptr<TableFilter> BloomFilter::Copy() const {
+	return make_uniq<BloomFilter>(filter);
+}
+
+unique_ptr<Expression> BloomFilter::ToExpression(const Expression &column) const {
+	// there is no scalar function that probes the filter - the filter is approximate, so we can conservatively
+	// return TRUE here and leave the exact filtering to the join
+	return make_uniq<BoundConstantExpression>(Value::BOOLEAN(true));
+}
+
+void BloomFilter::Serialize(Serializer &serializer) const {
+	TableFilter::Serialize(serializer);
+	serializer.WriteObject(200, "filter", [&](Serializer &obj) { filter->Serialize(obj); });
+}
+
+unique_ptr<TableFilter> BloomFilter::Deserialize(Deserializer &deserializer) {
+	shared_ptr<BlockedBloomFilter> filter;
+	deserializer.ReadObject(200, "filter", [&](Deserializer &obj) { filter = BlockedBloomFilter::Deserialize(obj); });
+	return make_uniq<BloomFilter>(std::move(filter));
+}
+
+} // namespace duckdb
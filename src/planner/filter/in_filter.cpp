@@ -0,0 +1,240 @@
+#include "duckdb/planner/filter/in_filter.hpp"
+
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+template <class T>
+struct InFilterLessThan {
+	bool operator()(const T &a, const T &b) const {
+		return LessThan::Operation<T>(a, b);
+	}
+};
+
+template <class T>
+static void SortValues(Vector &sorted_values, idx_t count) {
+	auto data = FlatVector::GetData<T>(sorted_values);
+	std::sort(data, data + count, InFilterLessThan<T>());
+}
+
+static void SortValues(Vector &sorted_values, idx_t count) {
+	switch (sorted_values.GetType().InternalType()) {
+	case PhysicalType::BOOL:
+		return SortValues<bool>(sorted_values, count);
+	case PhysicalType::UINT8:
+		return SortValues<uint8_t>(sorted_values, count);
+	case PhysicalType::UINT16:
+		return SortValues<uint16_t>(sorted_values, count);
+	case PhysicalType::UINT32:
+		return SortValues<uint32_t>(sorted_values, count);
+	case PhysicalType::UINT64:
+		return SortValues<uint64_t>(sorted_values, count);
+	case PhysicalType::UINT128:
+		return SortValues<uhugeint_t>(sorted_values, count);
+	case PhysicalType::INT8:
+		return SortValues<int8_t>(sorted_values, count);
+	case PhysicalType::INT16:
+		return SortValues<int16_t>(sorted_values, count);
+	case PhysicalType::INT32:
+		return SortValues<int32_t>(sorted_values, count);
+	case PhysicalType::INT64:
+		return SortValues<int64_t>(sorted_values, count);
+	case PhysicalType::INT128:
+		return SortValues<hugeint_t>(sorted_values, count);
+	case PhysicalType::FLOAT:
+		return SortValues<float>(sorted_values, count);
+	case PhysicalType::DOUBLE:
+		return SortValues<double>(sorted_values, count);
+	case PhysicalType::VARCHAR:
+		return SortValues<string_t>(sorted_values, count);
+	default:
+		throw InternalException("Unsupported type for InFilter");
+	}
+}
+
+InFilter::InFilter(vector<Value> values_p)
+    : TableFilter(TableFilterType::IN_FILTER), values(std::move(values_p)),
+      sorted_values(values.empty() ? LogicalType::SQLNULL : values[0].type(), MaxValue<idx_t>(values.size(), 1)) {
+	if (values.empty()) {
+		throw InternalException("InFilter requires at least one value");
+	}
+	for (auto &value : values) {
+		if (value.IsNull()) {
+			throw InternalException("InFilter values cannot be NULL");
+		}
+	}
+	D_ASSERT(SupportsType(values[0].type()));
+	// sort the values and remove any duplicates
+	std::sort(values.begin(), values.end());
+	auto end = std::unique(values.begin(), values.end(),
+	                       [](const Value &a, const Value &b) { return Value::NotDistinctFrom(a, b); });
+	values.erase(end, values.end());
+	for (idx_t i = 0; i < values.size(); i++) {
+		sorted_values.SetValue(i, values[i]);
+	}
+	SortValues(sorted_values, values.size());
+}
+
+bool InFilter::SupportsType(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+	case PhysicalType::VARCHAR:
+		return true;
+	default:
+		return false;
+	}
+}
+
+template <class T>
+static idx_t TemplatedInFilter(const Vector &sorted_values, idx_t value_count, UnifiedVectorFormat &vdata,
+                               SelectionVector &sel, idx_t &approved_tuple_count) {
+	auto begin = FlatVector::GetData<T>(sorted_values);
+	auto end = begin + value_count;
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+
+	SelectionVector result_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		auto vector_idx = vdata.sel->get_index(idx);
+		if (!vdata.validity.RowIsValid(vector_idx)) {
+			continue;
+		}
+		auto &input = data[vector_idx];
+		auto entry = std::lower_bound(begin, end, input, InFilterLessThan<T>());
+		if (entry != end && Equals::Operation<T>(*entry, input)) {
+			result_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(result_sel);
+	approved_tuple_count = result_count;
+	return result_count;
+}
+
+idx_t InFilter::Filter(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel,
+                       idx_t &approved_tuple_count) const {
+	auto value_count = values.size();
+	switch (vector.GetType().InternalType()) {
+	case PhysicalType::BOOL:
+		return TemplatedInFilter<bool>(sorted_values, value_count, vdata, sel, approved_tuple_count);
+	case PhysicalType::UINT8:
+		return TemplatedInFilter<uint8_t>(sorted_values, value_count, vdata, sel, approved_tuple_count);
+	case PhysicalType::UINT16:
+		return TemplatedInFilter<uint16_t>(sorted_values, value_count, vdata, sel, approved_tuple_count);
+	case PhysicalType::UINT32:
+		return TemplatedInFilter<uint32_t>(sorted_values, value_count, vdata, sel, approved_tuple_count);
+	case PhysicalType::UINT64:
+		return TemplatedInFilter<uint64_t>(sorted_values, value_count, vdata, sel, approved_tuple_count);
+	case PhysicalType::UINT128:
+		return TemplatedInFilter<uhugeint_t>(sorted_values, value_count, vdata, sel, approved_tuple_count);
+	case PhysicalType::INT8:
+		return TemplatedInFilter<int8_t>(sorted_values, value_count, vdata, sel, approved_tuple_count);
+	case PhysicalType::INT16:
+		return TemplatedInFilter<int16_t>(sorted_values, value_count, vdata, sel, approved_tuple_count);
+	case PhysicalType::INT32:
+		return TemplatedInFilter<int32_t>(sorted_values, value_count, vdata, sel, approved_tuple_count);
+	case PhysicalType::INT64:
+		return TemplatedInFilter<int64_t>(sorted_values, value_count, vdata, sel, approved_tuple_count);
+	case PhysicalType::INT128:
+		return TemplatedInFilter<hugeint_t>(sorted_values, value_count, vdata, sel, approved_tuple_count);
+	case PhysicalType::FLOAT:
+		return TemplatedInFilter<float>(sorted_values, value_count, vdata, sel, approved_tuple_count);
+	case PhysicalType::DOUBLE:
+		return TemplatedInFilter<double>(sorted_values, value_count, vdata, sel, approved_tuple_count);
+	case PhysicalType::VARCHAR:
+		return TemplatedInFilter<string_t>(sorted_values, value_count, vdata, sel, approved_tuple_count);
+	default:
+		throw InvalidTypeException(vector.GetType(), "Invalid type for IN filter pushed down to table scan");
+	}
+}
+
+FilterPropagateResult InFilter::CheckStatistics(BaseStatistics &stats) {
+	D_ASSERT(values[0].type().id() == stats.GetType().id());
+	switch (values[0].type().InternalType()) {
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		for (auto &value : values) {
+			if (NumericStats::CheckZonemap(stats, ExpressionType::COMPARE_EQUAL, value) !=
+			    FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+			}
+		}
+		// none of the values can be contained in the segment
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	case PhysicalType::VARCHAR:
+		for (auto &value : values) {
+			if (StringStats::CheckZonemap(stats, ExpressionType::COMPARE_EQUAL, StringValue::Get(value)) !=
+			    FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+			}
+		}
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	default:
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+}
+
+string InFilter::ToString(const string &column_name) {
+	vector<string> value_strings;
+	for (auto &value : values) {
+		value_strings.push_back(value.ToSQLString());
+	}
+	return column_name + " IN (" + StringUtil::Join(value_strings, ", ") + ")";
+}
+
+bool InFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<InFilter>();
+	if (other.values.size() != values.size()) {
+		return false;
+	}
+	for (idx_t i = 0; i < values.size(); i++) {
+		if (!Value::NotDistinctFrom(other.values[i], values[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+unique_ptr<TableFilter> InFilter::Copy() const {
+	return make_uniq<InFilter>(values);
+}
+
+unique_ptr<Expression> InFilter::ToExpression(const Expression &column) const {
+	auto result = make_uniq<BoundOperatorExpression>(ExpressionType::COMPARE_IN, LogicalType::BOOLEAN);
+	result->children.push_back(column.Copy());
+	for (auto &value : values) {
+		result->children.push_back(make_uniq<BoundConstantExpression>(value));
+	}
+	return std::move(result);
+}
+
+} // namespace duckdb
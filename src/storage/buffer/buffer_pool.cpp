@@ -4,6 +4,7 @@
 #include "duckdb/common/chrono.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/typedefs.hpp"
+#include "duckdb/common/types/hash.hpp"
 #include "duckdb/parallel/concurrentqueue.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/temporary_memory_manager.hpp"
@@ -39,9 +40,15 @@ shared_ptr<BlockHandle> BufferEvictionNode::TryGetBlockHandle() {
 
 typedef duckdb_moodycamel::ConcurrentQueue<BufferEvictionNode> eviction_queue_t;
 
-struct EvictionQueue {
+//! The result of trying to unload the next block of an eviction queue shard
+enum class EvictionIterationResult : uint8_t { EMPTY, NEXT, STOP };
+
+//! A single shard of an eviction queue
+//! Every block handle has at most one node in the queue: if a block is used again while it is in the queue, it is
+//! only marked as referenced, and gets a second chance (i.e., it is re-inserted) when it reaches the head of the queue
+struct EvictionQueueShard {
 public:
-	EvictionQueue() : evict_queue_insertions(0), total_dead_nodes(0) {
+	EvictionQueueShard() : evict_queue_insertions(0), total_dead_nodes(0) {
 	}
 
 public:
@@ -52,8 +59,9 @@ public:
 	bool TryDequeueWithLock(BufferEvictionNode &node);
 	//! Garbage collect dead nodes in the eviction queue.
 	void Purge();
+	//! Tries to unload the next block in the queue, calls "fn" if the block can be unloaded
 	template <typename FN>
-	void IterateUnloadableBlocks(FN fn);
+	EvictionIterationResult UnloadNextBlock(FN &fn);
 
 	//! Increment the dead node counter in the purge queue.
 	inline void IncrementDeadNodes() {
@@ -87,8 +95,7 @@ private:
 private:
 	//! Total number of insertions into the eviction queue. This guides the schedule for calling PurgeQueue.
 	atomic<idx_t> evict_queue_insertions;
-	//! Total dead nodes in the eviction queue. There are two scenarios in which a node dies: (1) we destroy its block
-	//! handle, or (2) we insert a newer version into the eviction queue.
+	//! Total dead nodes in the eviction queue, i.e., nodes of which the block handle has been destroyed.
 	atomic<idx_t> total_dead_nodes;
 
 	//! Locked, if a queue purge is currently active or we're trying to forcefully evict a node.
@@ -98,17 +105,56 @@ private:
 	vector<BufferEvictionNode> purge_nodes;
 };
 
-bool EvictionQueue::AddToEvictionQueue(BufferEvictionNode &&node) {
+//! The eviction queue of a buffer type - sharded by block handle, so concurrent threads rarely touch the same shard
+struct EvictionQueue {
+public:
+	//! The number of shards of an eviction queue
+	constexpr static idx_t SHARD_COUNT = 16;
+
+public:
+	EvictionQueue() : next_eviction_shard(0) {
+		for (auto &shard : shards) {
+			shard = make_uniq<EvictionQueueShard>();
+		}
+	}
+
+public:
+	//! Gets the shard that holds the eviction node of a block handle
+	EvictionQueueShard &GetShard(const BlockHandle &handle) {
+		return *shards[Hash<uint64_t>(CastPointerToValue(&handle)) % SHARD_COUNT];
+	}
+	//! Garbage collect dead nodes in all shards.
+	void Purge();
+	//! Iterates over the unloadable blocks of all shards (round-robin), until "fn" returns false
+	template <typename FN>
+	void IterateUnloadableBlocks(FN fn);
+	//! Iterates over the unloadable blocks of every shard separately, until "fn" returns false for that shard
+	template <typename FN>
+	void IterateUnloadableBlocksPerShard(FN fn);
+
+private:
+	array<unique_ptr<EvictionQueueShard>, SHARD_COUNT> shards;
+	//! The shard at which the next eviction starts, so evictions are spread evenly over the shards
+	atomic<idx_t> next_eviction_shard;
+};
+
+bool EvictionQueueShard::AddToEvictionQueue(BufferEvictionNode &&node) {
 	q.enqueue(std::move(node));
 	return ++evict_queue_insertions % INSERT_INTERVAL == 0;
 }
 
-bool EvictionQueue::TryDequeueWithLock(BufferEvictionNode &node) {
+bool EvictionQueueShard::TryDequeueWithLock(BufferEvictionNode &node) {
 	lock_guard<mutex> lock(purge_lock);
 	return q.try_dequeue(node);
 }
 
 void EvictionQueue::Purge() {
+	for (auto &shard : shards) {
+		shard->Purge();
+	}
+}
+
+void EvictionQueueShard::Purge() {
 	// only one thread purges the queue, all other threads early-out
 	if (!purge_lock.try_lock()) {
 		return;
@@ -168,7 +214,7 @@ void EvictionQueue::Purge() {
 	}
 }
 
-void EvictionQueue::PurgeIteration(const idx_t purge_size) {
+void EvictionQueueShard::PurgeIteration(const idx_t purge_size) {
 	// if this purge is significantly smaller or bigger than the previous purge, then
 	// we need to resize the purge_nodes vector. Note that this barely happens, as we
 	// purge queue_insertions * PURGE_SIZE_MULTIPLIER nodes
@@ -181,11 +227,11 @@ void EvictionQueue::PurgeIteration(const idx_t purge_size) {
 	idx_t actually_dequeued = q.try_dequeue_bulk(purge_nodes.begin(), purge_size);
 
 	// retrieve all alive nodes that have been wrongly dequeued
+	// note that we must keep the nodes of blocks that are currently pinned: a block is never inserted twice
 	idx_t alive_nodes = 0;
 	for (idx_t i = 0; i < actually_dequeued; i++) {
 		auto &node = purge_nodes[i];
-		auto handle = node.TryGetBlockHandle();
-		if (handle) {
+		if (!node.handle.expired()) {
 			q.enqueue(std::move(node));
 			alive_nodes++;
 		}
@@ -214,7 +260,6 @@ bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 	// The block handle is locked during this operation (Unpin),
 	// or the block handle is still a local variable (ConvertToPersistent)
 	D_ASSERT(handle->readers == 0);
-	auto ts = ++handle->eviction_seq_num;
 	if (track_eviction_timestamps) {
 		handle->lru_timestamp_msec =
 		    std::chrono::time_point_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now())
@@ -222,21 +267,25 @@ bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 		        .count();
 	}
 
-	if (ts != 1) {
-		// we add a newer version, i.e., we kill exactly one previous version
-		queue.IncrementDeadNodes();
+	if (handle->eviction_queued) {
+		// the block is still in the eviction queue: instead of adding a newer version, we give it a second chance
+		handle->eviction_referenced = true;
+		return false;
 	}
+	handle->eviction_queued = true;
+	handle->eviction_referenced = false;
+	auto ts = ++handle->eviction_seq_num;
 
-	// Get the eviction queue for the buffer type and add it
-	return queue.AddToEvictionQueue(BufferEvictionNode(weak_ptr<BlockHandle>(handle), ts));
+	// Get the eviction queue shard for the block handle and add it
+	return queue.GetShard(*handle).AddToEvictionQueue(BufferEvictionNode(weak_ptr<BlockHandle>(handle), ts));
 }
 
 EvictionQueue &BufferPool::GetEvictionQueueForType(FileBufferType type) {
 	return *queues[uint8_t(type) - 1];
 }
 
-void BufferPool::IncrementDeadNodes(FileBufferType type) {
-	GetEvictionQueueForType(type).IncrementDeadNodes();
+void BufferPool::IncrementDeadNodes(const BlockHandle &handle) {
+	GetEvictionQueueForType(handle.buffer->type).GetShard(handle).IncrementDeadNodes();
 }
 
 void BufferPool::UpdateUsedMemory(MemoryTag tag, int64_t size) {
@@ -336,7 +385,8 @@ idx_t BufferPool::PurgeAgedBlocks(uint32_t max_age_sec) {
 
 idx_t BufferPool::PurgeAgedBlocksInternal(EvictionQueue &queue, uint32_t max_age_sec, int64_t now, int64_t limit) {
 	idx_t purged_bytes = 0;
-	queue.IterateUnloadableBlocks([&](BufferEvictionNode &node, const shared_ptr<BlockHandle> &handle) {
+	// every shard is (approximately) ordered by age, so we stop iterating a shard at its first fresh block
+	queue.IterateUnloadableBlocksPerShard([&](BufferEvictionNode &node, const shared_ptr<BlockHandle> &handle) {
 		// We will unload this block regardless. But stop the iteration immediately afterward if this
 		// block is younger than the age threshold.
 		bool is_fresh = handle->lru_timestamp_msec >= limit && handle->lru_timestamp_msec <= now;
@@ -348,35 +398,80 @@ idx_t BufferPool::PurgeAgedBlocksInternal(EvictionQueue &queue, uint32_t max_age
 }
 
 template <typename FN>
-void EvictionQueue::IterateUnloadableBlocks(FN fn) {
-	for (;;) {
-		// get a block to unpin from the queue
-		BufferEvictionNode node;
-		if (!q.try_dequeue(node)) {
-			// we could not dequeue any eviction node, so we try one more time,
-			// but more aggressively
-			if (!TryDequeueWithLock(node)) {
-				return;
-			}
+EvictionIterationResult EvictionQueueShard::UnloadNextBlock(FN &fn) {
+	// get a block to unpin from the queue
+	BufferEvictionNode node;
+	if (!q.try_dequeue(node)) {
+		// we could not dequeue any eviction node, so we try one more time,
+		// but more aggressively
+		if (!TryDequeueWithLock(node)) {
+			return EvictionIterationResult::EMPTY;
 		}
+	}
 
-		// get a reference to the underlying block pointer
-		auto handle = node.TryGetBlockHandle();
-		if (!handle) {
-			DecrementDeadNodes();
-			continue;
-		}
+	// get a reference to the underlying block pointer
+	auto handle = node.handle.lock();
+	if (!handle) {
+		// BlockHandle has been destroyed
+		DecrementDeadNodes();
+		return EvictionIterationResult::NEXT;
+	}
 
-		// we might be able to free this block: grab the mutex and check if we can free it
-		lock_guard<mutex> lock(handle->lock);
-		if (!node.CanUnload(*handle)) {
-			// something changed in the mean-time, bail out
-			DecrementDeadNodes();
-			continue;
-		}
+	// we might be able to free this block: grab the mutex and check if we can free it
+	lock_guard<mutex> lock(handle->lock);
+	if (node.handle_sequence_number != handle->eviction_seq_num) {
+		// this is not the latest node of this handle
+		DecrementDeadNodes();
+		return EvictionIterationResult::NEXT;
+	}
+	if (!handle->CanUnload()) {
+		// the block is in use (or cannot be unloaded): drop it from the queue, it is added again when it is unpinned
+		handle->eviction_queued = false;
+		return EvictionIterationResult::NEXT;
+	}
+	if (handle->eviction_referenced) {
+		// the block was used since it was added to the queue: give it a second chance
+		handle->eviction_referenced = false;
+		q.enqueue(std::move(node));
+		return EvictionIterationResult::NEXT;
+	}
 
-		if (!fn(node, handle)) {
+	// the node leaves the queue
+	handle->eviction_queued = false;
+	if (!fn(node, handle)) {
+		return EvictionIterationResult::STOP;
+	}
+	return EvictionIterationResult::NEXT;
+}
+
+template <typename FN>
+void EvictionQueue::IterateUnloadableBlocks(FN fn) {
+	// visit the shards round-robin, starting at a different shard for every eviction
+	idx_t shard_idx = next_eviction_shard++;
+	idx_t empty_shards = 0;
+	while (empty_shards < SHARD_COUNT) {
+		auto &shard = *shards[shard_idx++ % SHARD_COUNT];
+		switch (shard.UnloadNextBlock(fn)) {
+		case EvictionIterationResult::EMPTY:
+			empty_shards++;
+			break;
+		case EvictionIterationResult::NEXT:
+			empty_shards = 0;
 			break;
+		case EvictionIterationResult::STOP:
+			return;
+		}
+	}
+}
+
+template <typename FN>
+void EvictionQueue::IterateUnloadableBlocksPerShard(FN fn) {
+	for (auto &shard : shards) {
+		for (;;) {
+			auto result = shard->UnloadNextBlock(fn);
+			if (result != EvictionIterationResult::NEXT) {
+				break;
+			}
 		}
 	}
 }
@@ -136,7 +136,7 @@ struct DictionaryCompressionCompressState : public DictionaryCompressionState {
 	    : DictionaryCompressionState(info), checkpointer(checkpointer_p),
 	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_DICTIONARY)),
 	      heap(BufferAllocator::Get(checkpointer.GetDatabase())) {
-		CreateEmptySegment(checkpointer.GetRowGroup().start);
+		CreateEmptySegment(checkpointer.GetRowStart());
 	}
 
 	ColumnDataCheckpointer &checkpointer;
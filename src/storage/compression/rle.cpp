@@ -140,7 +140,7 @@ struct RLECompressState : public CompressionState {
 	RLECompressState(ColumnDataCheckpointer &checkpointer_p, const CompressionInfo &info)
 	    : CompressionState(info), checkpointer(checkpointer_p),
 	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_RLE)) {
-		CreateEmptySegment(checkpointer.GetRowGroup().start);
+		CreateEmptySegment(checkpointer.GetRowStart());
 
 		state.dataptr = (void *)this;
 		max_rle_count = MaxRLECount();
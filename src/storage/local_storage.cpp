@@ -356,11 +356,13 @@ void LocalStorage::InitializeAppend(LocalAppendState &state, DataTable &table) {
 void LocalStorage::Append(LocalAppendState &state, DataChunk &chunk) {
 	// append to unique indices (if any)
 	auto storage = state.storage;
-	idx_t base_id =
-	    NumericCast<idx_t>(MAX_ROW_ID) + storage->row_groups->GetTotalRows() + state.append_state.total_append_count;
-	auto error = DataTable::AppendToIndexes(storage->indexes, chunk, NumericCast<row_t>(base_id));
-	if (error.HasError()) {
-		error.Throw();
+	if (!state.skip_local_indexes) {
+		idx_t base_id = NumericCast<idx_t>(MAX_ROW_ID) + storage->row_groups->GetTotalRows() +
+		                state.append_state.total_append_count;
+		auto error = DataTable::AppendToIndexes(storage->indexes, chunk, NumericCast<row_t>(base_id));
+		if (error.HasError()) {
+			error.Throw();
+		}
 	}
 
 	//! Append the chunk to the local storage
@@ -2,28 +2,43 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/assert.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 struct StorageLockInternals : enable_shared_from_this<StorageLockInternals> {
 public:
-	StorageLockInternals() : read_count(0) {
+	StorageLockInternals() : read_count(0), exclusive_active(false) {
 	}
 
 	mutex exclusive_lock;
 	atomic<idx_t> read_count;
+	//! Set while an exclusive lock is held or being acquired, readers then queue up behind the exclusive_lock
+	atomic<bool> exclusive_active;
+	//! Used by an exclusive lock to wait for the active readers to leave
+	mutex reader_lock;
+	std::condition_variable readers_done;
 
 public:
 	unique_ptr<StorageLockKey> GetExclusiveLock() {
 		exclusive_lock.lock();
-		while (read_count != 0) {
-		}
+		exclusive_active = true;
+		unique_lock<mutex> guard(reader_lock);
+		readers_done.wait(guard, [&]() { return read_count == 0; });
 		return make_uniq<StorageLockKey>(shared_from_this(), StorageLockType::EXCLUSIVE);
 	}
 
 	unique_ptr<StorageLockKey> GetSharedLock() {
-		exclusive_lock.lock();
+		// Optimistically register as a reader: if no exclusive lock is active, we are done without taking a mutex
+		// An exclusive lock sets "exclusive_active" before checking "read_count", so one of us sees the other
+		read_count++;
+		if (!exclusive_active) {
+			return make_uniq<StorageLockKey>(shared_from_this(), StorageLockType::SHARED);
+		}
+		// Back off, and wait until the exclusive lock is released
+		ReleaseSharedLock();
+		lock_guard<mutex> guard(exclusive_lock);
 		read_count++;
-		exclusive_lock.unlock();
 		return make_uniq<StorageLockKey>(shared_from_this(), StorageLockType::SHARED);
 	}
 
@@ -32,9 +47,10 @@ public:
 			// could not lock mutex
 			return nullptr;
 		}
+		exclusive_active = true;
 		if (read_count != 0) {
 			// there are active readers - cannot get exclusive lock
-			exclusive_lock.unlock();
+			ReleaseExclusiveLock();
 			return nullptr;
 		}
 		// success!
@@ -49,10 +65,11 @@ public:
 			// could not lock mutex
 			return nullptr;
 		}
+		exclusive_active = true;
 		if (read_count != 1) {
 			// other shared locks are active: failed to upgrade
 			D_ASSERT(read_count != 0);
-			exclusive_lock.unlock();
+			ReleaseExclusiveLock();
 			return nullptr;
 		}
 		// no other shared locks active: success!
@@ -60,10 +77,15 @@ public:
 	}
 
 	void ReleaseExclusiveLock() {
+		exclusive_active = false;
 		exclusive_lock.unlock();
 	}
 	void ReleaseSharedLock() {
-		read_count--;
+		if (--read_count == 0 && exclusive_active) {
+			// the last reader wakes up the exclusive lock that is waiting for the readers to leave
+			lock_guard<mutex> guard(reader_lock);
+			readers_done.notify_all();
+		}
 	}
 };
 
@@ -2,6 +2,7 @@
 
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/profiler.hpp"
 #include "duckdb/common/serializer/buffered_file_reader.hpp"
 #include "duckdb/function/function.hpp"
 #include "duckdb/main/attached_database.hpp"
@@ -211,8 +212,12 @@ void SingleFileStorageManager::LoadDatabase(const optional_idx block_alloc_size)
 		}
 
 		// load the db from storage
+		Profiler profiler;
+		profiler.Start();
 		auto checkpoint_reader = SingleFileCheckpointReader(*this);
 		checkpoint_reader.LoadFromStorage();
+		profiler.End();
+		load_info.checkpoint_load_time = profiler.Elapsed();
 
 		// check if the WAL file exists
 		auto wal_path = GetWALPath();
@@ -298,7 +303,8 @@ void SingleFileStorageCommitState::FlushCommit() {
 	if (state != WALCommitState::IN_PROGRESS) {
 		return;
 	}
-	wal.Flush();
+	// with group commit the WAL is synced by the transaction manager after the WAL lock is released
+	wal.Flush(!wal.DeferCommitSync());
 	state = WALCommitState::FLUSHED;
 }
 
@@ -250,13 +250,9 @@ void ChunkVectorInfo::CommitAppend(transaction_t commit_id, idx_t start, idx_t e
 }
 
 bool ChunkVectorInfo::Cleanup(transaction_t lowest_transaction, unique_ptr<ChunkInfo> &result) const {
-	if (any_deleted) {
-		// if any rows are deleted we can't clean-up
-		return false;
-	}
 	// check if the insertion markers have to be used by all transactions going forward
 	if (!same_inserted_id) {
-		for (idx_t idx = 1; idx < STANDARD_VECTOR_SIZE; idx++) {
+		for (idx_t idx = 0; idx < STANDARD_VECTOR_SIZE; idx++) {
 			if (inserted[idx] > lowest_transaction) {
 				// transaction was inserted after the lowest transaction start
 				// we still need to use an older version - cannot compress
@@ -268,6 +264,52 @@ bool ChunkVectorInfo::Cleanup(transaction_t lowest_transaction, unique_ptr<Chunk
 		// we still need to use an older version - cannot compress
 		return false;
 	}
+	if (!any_deleted) {
+		// all tuples are visible to all transactions: the chunk info can be removed entirely
+		return true;
+	}
+	// check if the deletes are visible to all transactions going forward as well
+	idx_t deleted_count = 0;
+	bool is_compact = same_inserted_id && insert_id == 0;
+	for (idx_t idx = 0; idx < STANDARD_VECTOR_SIZE; idx++) {
+		if (deleted[idx] == NOT_DELETED_ID) {
+			continue;
+		}
+		if (deleted[idx] > lowest_transaction) {
+			// the delete is either uncommitted or an active transaction still needs the deleted tuple
+			return false;
+		}
+		if (deleted[idx] != 0) {
+			is_compact = false;
+		}
+		deleted_count++;
+	}
+	if (deleted_count == 0) {
+		// all deletes were reverted
+		return true;
+	}
+	if (deleted_count == STANDARD_VECTOR_SIZE) {
+		// all tuples are deleted for all transactions: replace with a constant info
+		auto constant_info = make_uniq<ChunkConstantInfo>(start);
+		constant_info->insert_id = 0;
+		constant_info->delete_id = 0;
+		result = std::move(constant_info);
+		return true;
+	}
+	if (is_compact) {
+		// the chunk info is already compacted
+		return false;
+	}
+	// collapse the version information into the state in which it would be read back from disk: only the deletes
+	// have to be checked by scans going forward
+	auto vector_info = make_uniq<ChunkVectorInfo>(start);
+	vector_info->any_deleted = true;
+	for (idx_t idx = 0; idx < STANDARD_VECTOR_SIZE; idx++) {
+		if (deleted[idx] != NOT_DELETED_ID) {
+			vector_info->deleted[idx] = 0;
+		}
+	}
+	result = std::move(vector_info);
 	return true;
 }
 
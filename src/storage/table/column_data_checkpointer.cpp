@@ -13,12 +13,6 @@ ColumnDataCheckpointer::ColumnDataCheckpointer(ColumnData &col_data_p, RowGroup
       is_validity(GetType().id() == LogicalTypeId::VALIDITY),
       intermediate(is_validity ? LogicalType::BOOLEAN : GetType(), true, is_validity),
       checkpoint_info(checkpoint_info_p) {
-
-	auto &config = DBConfig::GetConfig(GetDatabase());
-	auto functions = config.GetCompressionFunctions(GetType().InternalType());
-	for (auto &func : functions) {
-		compression_functions.push_back(&func.get());
-	}
 }
 
 DatabaseInstance &ColumnDataCheckpointer::GetDatabase() {
@@ -29,6 +23,11 @@ const LogicalType &ColumnDataCheckpointer::GetType() const {
 	return col_data.type;
 }
 
+idx_t ColumnDataCheckpointer::GetRowStart() const {
+	D_ASSERT(!nodes.empty());
+	return nodes[0].node->start;
+}
+
 ColumnData &ColumnDataCheckpointer::GetColumnData() {
 	return col_data;
 }
@@ -97,8 +96,14 @@ CompressionType ForceCompression(vector<optional_ptr<CompressionFunction>> &comp
 }
 
 unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx_t &compression_idx) {
-	D_ASSERT(!compression_functions.empty());
 	auto &config = DBConfig::GetConfig(GetDatabase());
+	// the previous run of segments might have eliminated some of the compression functions
+	compression_functions.clear();
+	auto functions = config.GetCompressionFunctions(GetType().InternalType());
+	for (auto &func : functions) {
+		compression_functions.push_back(&func.get());
+	}
+	D_ASSERT(!compression_functions.empty());
 	CompressionType forced_method = CompressionType::COMPRESSION_AUTO;
 
 	auto compression_type = checkpoint_info.GetCompressionType();
@@ -205,50 +210,78 @@ void ColumnDataCheckpointer::WriteToDisk() {
 	nodes.clear();
 }
 
-bool ColumnDataCheckpointer::HasChanges() {
-	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
-		auto segment = nodes[segment_idx].node.get();
-		if (segment->segment_type == ColumnSegmentType::TRANSIENT) {
-			// transient segment: always need to write to disk
-			return true;
-		} else {
-			// persistent segment; check if there were any updates or deletions in this segment
-			idx_t start_row_idx = segment->start - row_group.start;
-			idx_t end_row_idx = start_row_idx + segment->count;
-			if (col_data.updates && col_data.updates->HasUpdates(start_row_idx, end_row_idx)) {
-				return true;
-			}
-		}
+bool ColumnDataCheckpointer::HasChanges(ColumnSegment &segment) {
+	if (segment.segment_type == ColumnSegmentType::TRANSIENT) {
+		// transient segment: always need to write to disk
+		return true;
 	}
-	return false;
+	// persistent segment; check if there were any updates in this segment
+	idx_t start_row_idx = segment.start - row_group.start;
+	idx_t end_row_idx = start_row_idx + segment.count;
+	return col_data.updates && col_data.updates->HasUpdates(start_row_idx, end_row_idx);
 }
 
-void ColumnDataCheckpointer::WritePersistentSegments() {
-	// all segments are persistent and there are no updates
-	// we only need to write the metadata
-	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
-		auto segment = nodes[segment_idx].node.get();
-		auto pointer = segment->GetDataPointer();
+void ColumnDataCheckpointer::WritePersistentSegment(unique_ptr<ColumnSegment> segment) {
+	// the segment is persistent and there are no updates - we only need to write the metadata
+	auto pointer = segment->GetDataPointer();
 
-		// merge the persistent stats into the global column stats
-		state.global_stats->Merge(segment->stats.statistics);
+	// merge the persistent stats into the global column stats
+	state.global_stats->Merge(segment->stats.statistics);
 
-		// directly append the current segment to the new tree
-		state.new_tree.AppendSegment(std::move(nodes[segment_idx].node));
+	// directly append the current segment to the new tree
+	state.new_tree.AppendSegment(std::move(segment));
 
-		state.data_pointers.push_back(std::move(pointer));
-	}
+	state.data_pointers.push_back(std::move(pointer));
 }
 
 void ColumnDataCheckpointer::Checkpoint(vector<SegmentNode<ColumnSegment>> nodes_p) {
 	D_ASSERT(!nodes_p.empty());
-	this->nodes = std::move(nodes_p);
-	// first check if any of the segments have changes
-	if (!HasChanges()) {
+	// figure out which of the segments have changed since they were last written
+	vector<bool> changed(nodes_p.size());
+	bool has_changes = false;
+	bool has_transient = false;
+	for (idx_t segment_idx = 0; segment_idx < nodes_p.size(); segment_idx++) {
+		auto &segment = *nodes_p[segment_idx].node;
+		changed[segment_idx] = HasChanges(segment);
+		has_changes = has_changes || changed[segment_idx];
+		has_transient = has_transient || segment.segment_type == ColumnSegmentType::TRANSIENT;
+	}
+	if (!has_changes) {
 		// no changes: only need to write the metadata for this column
-		WritePersistentSegments();
-	} else {
-		// there are changes: rewrite the set of columns);
+		for (auto &node : nodes_p) {
+			WritePersistentSegment(std::move(node.node));
+		}
+		return;
+	}
+	if (has_transient) {
+		// appended data: rewrite the whole column so the new rows are compressed together with the existing rows
+		this->nodes = std::move(nodes_p);
+		WriteToDisk();
+		return;
+	}
+	// only updates: only the changed segments are rewritten, unchanged segments keep their blocks
+	// small unchanged segments that border on a changed segment are rewritten along with it
+	// this prevents a column from fragmenting into many tiny segments
+	vector<bool> rewrite(changed);
+	for (idx_t segment_idx = 0; segment_idx < nodes_p.size(); segment_idx++) {
+		if (changed[segment_idx] || nodes_p[segment_idx].node->count >= MINIMUM_PERSISTENT_SEGMENT_COUNT) {
+			continue;
+		}
+		bool changed_before = segment_idx > 0 && changed[segment_idx - 1];
+		bool changed_after = segment_idx + 1 < nodes_p.size() && changed[segment_idx + 1];
+		rewrite[segment_idx] = changed_before || changed_after;
+	}
+	// every consecutive run of segments that needs to be rewritten is compressed together
+	for (idx_t segment_idx = 0; segment_idx < nodes_p.size(); segment_idx++) {
+		if (!rewrite[segment_idx]) {
+			WritePersistentSegment(std::move(nodes_p[segment_idx].node));
+			continue;
+		}
+		D_ASSERT(nodes.empty());
+		for (; segment_idx < nodes_p.size() && rewrite[segment_idx]; segment_idx++) {
+			nodes.push_back(std::move(nodes_p[segment_idx]));
+		}
+		segment_idx--;
 		WriteToDisk();
 	}
 }
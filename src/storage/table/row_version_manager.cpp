@@ -143,17 +143,27 @@ void RowVersionManager::CleanupAppend(transaction_t lowest_active_transaction, i
 			// not written fully - skip
 			continue;
 		}
-		if (!vector_info[vector_idx]) {
-			// already vacuumed - skip
-			continue;
-		}
-		auto &info = *vector_info[vector_idx];
 		// if we wrote the entire chunk info try to compress it
-		unique_ptr<ChunkInfo> new_info;
-		auto cleanup = info.Cleanup(lowest_active_transaction, new_info);
-		if (cleanup) {
-			vector_info[vector_idx] = std::move(new_info);
-		}
+		CleanupVectorInfo(lowest_active_transaction, vector_idx);
+	}
+}
+
+void RowVersionManager::CleanupDelete(transaction_t lowest_active_transaction, idx_t vector_idx) {
+	lock_guard<mutex> lock(version_lock);
+	CleanupVectorInfo(lowest_active_transaction, vector_idx);
+}
+
+void RowVersionManager::CleanupVectorInfo(transaction_t lowest_active_transaction, idx_t vector_idx) {
+	if (!vector_info[vector_idx]) {
+		// already vacuumed - skip
+		return;
+	}
+	auto &info = *vector_info[vector_idx];
+	// the version info only changes representation here: the checkpointed version info remains valid
+	unique_ptr<ChunkInfo> new_info;
+	auto cleanup = info.Cleanup(lowest_active_transaction, new_info);
+	if (cleanup) {
+		vector_info[vector_idx] = std::move(new_info);
 	}
 }
 
@@ -174,8 +184,10 @@ ChunkVectorInfo &RowVersionManager::GetVectorInfo(idx_t vector_idx) {
 		// info exists but it's a constant info: convert to a vector info
 		auto new_info = make_uniq<ChunkVectorInfo>(start + vector_idx * STANDARD_VECTOR_SIZE);
 		new_info->insert_id = constant.insert_id;
+		new_info->any_deleted = constant.delete_id != NOT_DELETED_ID;
 		for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
 			new_info->inserted[i] = constant.insert_id;
+			new_info->deleted[i] = constant.delete_id;
 		}
 		vector_info[vector_idx] = std::move(new_info);
 	}
@@ -1223,12 +1223,13 @@ bool UpdateSegment::HasUncommittedUpdates(idx_t vector_index) {
 }
 
 bool UpdateSegment::HasUpdates(idx_t start_row_index, idx_t end_row_index) {
-	if (!HasUpdates()) {
+	if (!HasUpdates() || start_row_index >= end_row_index) {
 		return false;
 	}
 	auto read_lock = lock.GetSharedLock();
+	// the end row index is exclusive
 	idx_t base_vector_index = start_row_index / STANDARD_VECTOR_SIZE;
-	idx_t end_vector_index = end_row_index / STANDARD_VECTOR_SIZE;
+	idx_t end_vector_index = (end_row_index - 1) / STANDARD_VECTOR_SIZE;
 	for (idx_t i = base_vector_index; i <= end_vector_index; i++) {
 		if (root->info[i]) {
 			return true;
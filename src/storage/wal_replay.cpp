@@ -6,10 +6,12 @@
 #include "duckdb/catalog/catalog_entry/view_catalog_entry.hpp"
 #include "duckdb/common/checksum.hpp"
 #include "duckdb/common/printer.hpp"
+#include "duckdb/common/profiler.hpp"
 #include "duckdb/common/serializer/binary_deserializer.hpp"
 #include "duckdb/common/serializer/buffered_file_reader.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/thread.hpp"
 #include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/execution/index/index_type_set.hpp"
 #include "duckdb/main/attached_database.hpp"
@@ -17,6 +19,8 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/connection.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/alter_table_info.hpp"
 #include "duckdb/parser/parsed_data/create_schema_info.hpp"
 #include "duckdb/parser/parsed_data/create_view_info.hpp"
@@ -32,29 +36,66 @@
 
 namespace duckdb {
 
+//! A serialized insert entry whose replay is deferred
+struct ReplayInsertEntry {
+	ReplayInsertEntry(unique_ptr<data_t[]> data_p, idx_t size) : data(std::move(data_p)), size(size) {
+	}
+
+	unique_ptr<data_t[]> data;
+	idx_t size;
+	DataChunk chunk;
+};
+
+//! The deferred inserts into a single table
+struct ReplayTableInserts {
+	explicit ReplayTableInserts(TableCatalogEntry &table) : table(table) {
+	}
+
+	TableCatalogEntry &table;
+	vector<unique_ptr<ReplayInsertEntry>> entries;
+	LocalAppendState append_state;
+	vector<unique_ptr<BoundConstraint>> bound_constraints;
+};
+
 class ReplayState {
 public:
 	ReplayState(AttachedDatabase &db, ClientContext &context) : db(db), context(context), catalog(db.GetCatalog()) {
 	}
 
+	//! Defer the replay of a serialized insert into the current table
+	void DeferInsert(unique_ptr<data_t[]> data, idx_t size);
+	//! Replay all deferred inserts
+	void FlushInserts();
+
 	AttachedDatabase &db;
 	ClientContext &context;
 	Catalog &catalog;
 	optional_ptr<TableCatalogEntry> current_table;
 	MetaBlockPointer checkpoint_id;
 	idx_t wal_version = 1;
+	//! The number of replayed entries
+	idx_t entry_count = 0;
+
+private:
+	//! Work on the scheduled tasks of the executor until they are all finished
+	void WorkOnTasks(TaskExecutor &executor, idx_t task_count);
+
+	//! The deferred inserts, per table
+	reference_map_t<TableCatalogEntry, unique_ptr<ReplayTableInserts>> deferred_inserts;
+	//! The total size of the deferred inserts
+	idx_t deferred_size = 0;
 };
 
 class WriteAheadLogDeserializer {
 public:
 	WriteAheadLogDeserializer(ReplayState &state_p, BufferedFileReader &stream_p, bool deserialize_only = false)
-	    : state(state_p), db(state.db), context(state.context), catalog(state.catalog), data(nullptr),
+	    : state(state_p), db(state.db), context(state.context), catalog(state.catalog), data(nullptr), size(0),
 	      stream(nullptr, 0), deserializer(stream_p), deserialize_only(deserialize_only) {
 	}
 	WriteAheadLogDeserializer(ReplayState &state_p, unique_ptr<data_t[]> data_p, idx_t size,
 	                          bool deserialize_only = false)
 	    : state(state_p), db(state.db), context(state.context), catalog(state.catalog), data(std::move(data_p)),
-	      stream(data.get(), size), deserializer(stream), deserialize_only(deserialize_only) {
+	      size(size), stream(data.get(), size), deserializer(stream), deserialize_only(deserialize_only) {
 	}
 
 	static WriteAheadLogDeserializer Open(ReplayState &state_p, BufferedFileReader &stream,
@@ -97,10 +138,39 @@ public:
 	bool ReplayEntry() {
 		deserializer.Begin();
 		auto wal_type = deserializer.ReadProperty<WALType>(100, "wal_type");
+		state.entry_count++;
 		if (wal_type == WALType::WAL_FLUSH) {
 			deserializer.End();
+			if (!DeserializeOnly()) {
+				state.FlushInserts();
+			}
 			return true;
 		}
+		if (data) {
+			// the entry has been read into memory entirely - we do not need to deserialize all of it
+			switch (wal_type) {
+			case WALType::INSERT_TUPLE:
+				if (DeserializeOnly()) {
+					return false;
+				}
+				// inserts are deserialized and applied in parallel later on
+				state.DeferInsert(std::move(data), size);
+				return false;
+			case WALType::DELETE_TUPLE:
+			case WALType::UPDATE_TUPLE:
+				if (DeserializeOnly()) {
+					// the data of deletes and updates is not needed to find the checkpoint marker
+					return false;
+				}
+				break;
+			default:
+				break;
+			}
+		}
+		if (!DeserializeOnly() && wal_type != WALType::USE_TABLE) {
+			// replay the deferred inserts before replaying anything that might depend on them
+			state.FlushInserts();
+		}
 		ReplayEntry(wal_type);
 		deserializer.End();
 		return false;
@@ -154,11 +224,138 @@ private:
 	ClientContext &context;
 	Catalog &catalog;
 	unique_ptr<data_t[]> data;
+	idx_t size;
 	MemoryStream stream;
 	BinaryDeserializer deserializer;
 	bool deserialize_only;
 };
 
+//===--------------------------------------------------------------------===//
+// Deferred Inserts
+//===--------------------------------------------------------------------===//
+//! The number of deferred insert entries that are deserialized by a single task
+static constexpr idx_t REPLAY_DESERIALIZE_BATCH_SIZE = 16;
+//! The maximum total size of the deferred inserts before they are replayed
+static constexpr idx_t REPLAY_DEFERRED_INSERT_LIMIT = 64ULL * 1024ULL * 1024ULL;
+
+void ReplayState::DeferInsert(unique_ptr<data_t[]> data, idx_t size) {
+	if (!current_table) {
+		throw InternalException("Corrupt WAL: insert without table");
+	}
+	auto entry = deferred_inserts.find(*current_table);
+	if (entry == deferred_inserts.end()) {
+		auto table_inserts = make_uniq<ReplayTableInserts>(*current_table);
+		entry = deferred_inserts.emplace(*current_table, std::move(table_inserts)).first;
+	}
+	entry->second->entries.push_back(make_uniq<ReplayInsertEntry>(std::move(data), size));
+	deferred_size += size;
+	if (deferred_size >= REPLAY_DEFERRED_INSERT_LIMIT) {
+		FlushInserts();
+	}
+}
+
+class ReplayDeserializeTask : public BaseExecutorTask {
+public:
+	ReplayDeserializeTask(TaskExecutor &executor, vector<reference<ReplayInsertEntry>> entries_p)
+	    : BaseExecutorTask(executor), entries(std::move(entries_p)) {
+	}
+
+	void ExecuteTask() override {
+		for (auto &entry_ref : entries) {
+			auto &entry = entry_ref.get();
+			MemoryStream stream(entry.data.get(), entry.size);
+			BinaryDeserializer deserializer(stream);
+			deserializer.Begin();
+			deserializer.ReadProperty<WALType>(100, "wal_type");
+			deserializer.ReadObject(101, "chunk", [&](Deserializer &object) { entry.chunk.Deserialize(object); });
+			deserializer.End();
+			entry.data.reset();
+		}
+	}
+
+private:
+	vector<reference<ReplayInsertEntry>> entries;
+};
+
+void ReplayState::WorkOnTasks(TaskExecutor &executor, idx_t task_count) {
+#ifndef DUCKDB_NO_THREADS
+	// the scheduler only launches its threads after the database has been loaded, so replay at startup cannot use
+	// them - instead we launch helper threads that only work on our own tasks and exit once these are done
+	auto thread_count = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+	auto max_threads = DBConfig::GetConfig(context).options.maximum_threads;
+	idx_t helper_count = 0;
+	if (task_count > 1 && thread_count < max_threads) {
+		helper_count = MinValue<idx_t>(max_threads - thread_count, task_count - 1);
+	}
+	vector<thread> helpers;
+	for (idx_t i = 0; i < helper_count; i++) {
+		helpers.emplace_back([&executor]() {
+			shared_ptr<Task> task;
+			while (executor.GetTask(task)) {
+				task->Execute(TaskExecutionMode::PROCESS_ALL);
+				task.reset();
+			}
+		});
+	}
+	try {
+		executor.WorkOnTasks();
+	} catch (...) {
+		for (auto &helper : helpers) {
+			helper.join();
+		}
+		throw;
+	}
+	for (auto &helper : helpers) {
+		helper.join();
+	}
+#else
+	executor.WorkOnTasks();
+#endif
+}
+
+void ReplayState::FlushInserts() {
+	if (deferred_inserts.empty()) {
+		return;
+	}
+	// deserialize the entries in parallel
+	TaskExecutor executor(context);
+	vector<reference<ReplayInsertEntry>> batch;
+	idx_t task_count = 0;
+	for (auto &table_inserts : deferred_inserts) {
+		for (auto &entry : table_inserts.second->entries) {
+			batch.push_back(*entry);
+			if (batch.size() == REPLAY_DESERIALIZE_BATCH_SIZE) {
+				executor.ScheduleTask(make_uniq<ReplayDeserializeTask>(executor, std::move(batch)));
+				batch.clear();
+				task_count++;
+			}
+		}
+	}
+	if (!batch.empty()) {
+		executor.ScheduleTask(make_uniq<ReplayDeserializeTask>(executor, std::move(batch)));
+		task_count++;
+	}
+	WorkOnTasks(executor, task_count);
+
+	// append to the transaction-local storage of the tables
+	// this happens on a single thread: all tables share the local storage of the replay transaction
+	// index maintenance is deferred: the rows are appended to the indexes of each table in bulk on commit
+	for (auto &table_inserts : deferred_inserts) {
+		auto &inserts = *table_inserts.second;
+		auto &storage = inserts.table.GetStorage();
+		storage.InitializeLocalAppend(inserts.append_state, inserts.table, context, inserts.bound_constraints);
+		inserts.append_state.skip_local_indexes = true;
+		for (auto &entry : inserts.entries) {
+			// we don't do any constraint verification here
+			storage.LocalAppend(inserts.append_state, inserts.table, context, entry->chunk, true);
+			entry.reset();
+		}
+		storage.FinalizeLocalAppend(inserts.append_state);
+	}
+	deferred_inserts.clear();
+	deferred_size = 0;
+}
+
 //===--------------------------------------------------------------------===//
 // Replay
 //===--------------------------------------------------------------------===//
@@ -170,6 +367,10 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 		// WAL is empty
 		return false;
 	}
+	auto &load_info = database.GetStorageManager().GetLoadInfo();
+	load_info.wal_size = reader.FileSize();
+	Profiler profiler;
+	profiler.Start();
 
 	con.BeginTransaction();
 	MetaTransaction::Get(*con.context).ModifyDatabase(database);
@@ -197,6 +398,8 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 			error.Throw("Failure while replaying WAL file \"" + wal_path + "\": ");
 		}
 	} // LCOV_EXCL_STOP
+	profiler.End();
+	load_info.wal_scan_time = profiler.Elapsed();
 	if (checkpoint_state.checkpoint_id.IsValid()) {
 		// there is a checkpoint flag: check if we need to deserialize the WAL
 		auto &manager = database.GetStorageManager();
@@ -212,6 +415,7 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 
 	// reset the reader - we are going to read the WAL from the beginning again
 	reader.Reset();
+	profiler.Start();
 
 	// replay the WAL
 	// note that everything is wrapped inside a try/catch block here
@@ -222,6 +426,7 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 			auto deserializer = WriteAheadLogDeserializer::Open(state, reader);
 			if (deserializer.ReplayEntry()) {
 				con.Commit();
+				load_info.wal_transactions++;
 				// check if the file is exhausted
 				if (reader.Finished()) {
 					// we finished reading the file: break
@@ -246,6 +451,9 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 		con.Query("ROLLBACK");
 		throw;
 	} // LCOV_EXCL_STOP
+	profiler.End();
+	load_info.wal_replay_time = profiler.Elapsed();
+	load_info.wal_entries = state.entry_count;
 	return false;
 }
 
@@ -8,6 +8,7 @@
 #include "duckdb/catalog/catalog_entry/view_catalog_entry.hpp"
 #include "duckdb/common/serializer/binary_serializer.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/main/valid_checker.hpp"
 #include "duckdb/parser/parsed_data/alter_table_info.hpp"
 #include "duckdb/storage/index.hpp"
 #include "duckdb/execution/index/bound_index.hpp"
@@ -22,10 +23,11 @@ namespace duckdb {
 const uint64_t WAL_VERSION_NUMBER = 2;
 
 WriteAheadLog::WriteAheadLog(AttachedDatabase &database, const string &wal_path)
-    : database(database), wal_path(wal_path), wal_size(0), initialized(false) {
+    : database(database), wal_path(wal_path), wal_size(0), initialized(false), synced_size(0) {
 }
 
 WriteAheadLog::~WriteAheadLog() {
+	StopFlusher();
 }
 
 BufferedFileWriter &WriteAheadLog::Initialize() {
@@ -38,6 +40,7 @@ BufferedFileWriter &WriteAheadLog::Initialize() {
 		                                       FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE |
 		                                           FileFlags::FILE_FLAGS_APPEND);
 		wal_size = writer->GetFileSize();
+		synced_size = wal_size;
 		initialized = true;
 	}
 	return *writer;
@@ -66,18 +69,22 @@ void WriteAheadLog::Truncate(idx_t size) {
 	if (!Initialized()) {
 		return;
 	}
+	lock_guard<mutex> guard(sync_lock);
 	writer->Truncate(size);
 	wal_size = writer->GetFileSize();
+	synced_size = MinValue<idx_t>(synced_size, wal_size);
 }
 
 void WriteAheadLog::Delete() {
 	if (!Initialized()) {
 		return;
 	}
+	lock_guard<mutex> guard(sync_lock);
 	writer.reset();
 	auto &fs = FileSystem::Get(database);
 	fs.RemoveFile(wal_path);
 	wal_size = 0;
+	synced_size = 0;
 }
 
 //===--------------------------------------------------------------------===//
@@ -409,7 +416,7 @@ void WriteAheadLog::WriteAlter(const AlterInfo &info) {
 //===--------------------------------------------------------------------===//
 // FLUSH
 //===--------------------------------------------------------------------===//
-void WriteAheadLog::Flush() {
+void WriteAheadLog::Flush(bool sync) {
 	if (!writer) {
 		return;
 	}
@@ -418,9 +425,121 @@ void WriteAheadLog::Flush() {
 	WriteAheadLogSerializer serializer(*this, WALType::WAL_FLUSH);
 	serializer.End();
 
+	if (!sync) {
+		// hand the changes to the OS - the sync happens in SyncCommit
+		writer->Flush();
+		wal_size = writer->GetFileSize();
+		return;
+	}
 	// flushes all changes made to the WAL to disk
 	writer->Sync();
 	wal_size = writer->GetFileSize();
+
+	lock_guard<mutex> guard(sync_lock);
+	synced_size = wal_size;
+	last_sync = steady_clock::now();
+}
+
+bool WriteAheadLog::DeferCommitSync() {
+	auto &options = DBConfig::Get(database).options;
+	return options.wal_group_commit || options.wal_sync_interval > 0;
+}
+
+void WriteAheadLog::SyncCommit(idx_t size) {
+	lock_guard<mutex> guard(sync_lock);
+	if (!writer || synced_size >= size) {
+		// another commit already synced our changes
+		return;
+	}
+	auto sync_interval = DBConfig::Get(database).options.wal_sync_interval;
+	auto now = steady_clock::now();
+	if (sync_interval > 0 && idx_t(duration_cast<milliseconds>(now - last_sync).count()) < sync_interval) {
+		// relaxed durability: the WAL was synced recently - leave the sync to the background flusher
+		StartFlusher();
+		flusher_cv.notify_one();
+		return;
+	}
+	// sync everything that has been written so far, including the commits of other transactions that were written
+	// while we were waiting for the sync lock
+	SyncInternal();
+}
+
+void WriteAheadLog::SyncInternal() {
+	if (!sync_error.empty()) {
+		// fsync does not reliably report an error twice - once a sync has failed we cannot trust any later sync
+		throw IOException("Could not sync the WAL: a previous sync failed: %s", sync_error);
+	}
+	idx_t sync_target = wal_size;
+	try {
+		writer->handle->Sync();
+	} catch (std::exception &ex) {
+		ErrorData error(ex);
+		sync_error = error.RawMessage();
+		throw;
+	}
+	synced_size = sync_target;
+	last_sync = steady_clock::now();
+}
+
+void WriteAheadLog::StartFlusher() {
+#ifndef DUCKDB_NO_THREADS
+	if (!flusher && !stop_flusher) {
+		flusher = make_uniq<thread>([this]() { RunFlusher(); });
+	}
+#endif
+}
+
+void WriteAheadLog::RunFlusher() {
+	unique_lock<mutex> guard(sync_lock);
+	while (true) {
+		// wait until a commit has left a sync to us
+		flusher_cv.wait(guard, [&]() { return stop_flusher || (writer && synced_size < wal_size); });
+		if (stop_flusher) {
+			return;
+		}
+		// sync at the latest one interval after the last sync
+		auto sync_interval = DBConfig::Get(database).options.wal_sync_interval;
+		flusher_cv.wait_until(guard, last_sync + milliseconds(sync_interval), [&]() { return stop_flusher; });
+		if (stop_flusher) {
+			return;
+		}
+		if (!writer || synced_size >= wal_size) {
+			// a commit synced the WAL in the meantime
+			continue;
+		}
+		try {
+			SyncInternal();
+		} catch (std::exception &ex) {
+			// the commits we were syncing have already been acknowledged - the database is in an unknown state
+			ErrorData error(ex);
+			ValidChecker::Invalidate(database.GetDatabase(), "Failed to sync the WAL: " + error.Message());
+			return;
+		}
+	}
+}
+
+void WriteAheadLog::StopFlusher() {
+	unique_ptr<thread> stopped_flusher;
+	{
+		lock_guard<mutex> guard(sync_lock);
+		stop_flusher = true;
+		stopped_flusher = std::move(flusher);
+	}
+	flusher_cv.notify_all();
+	if (stopped_flusher) {
+		stopped_flusher->join();
+	}
+	// sync the commits the flusher has not synced yet, so closing the database makes every commit durable
+	lock_guard<mutex> guard(sync_lock);
+	if (!writer || !sync_error.empty() || synced_size >= wal_size) {
+		return;
+	}
+	try {
+		SyncInternal();
+	} catch (std::exception &ex) {
+		ErrorData error(ex);
+		ValidChecker::Invalidate(database.GetDatabase(), "Failed to sync the WAL: " + error.Message());
+	}
 }
 
 } // namespace duckdb
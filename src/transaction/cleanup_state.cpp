@@ -59,6 +59,9 @@ void CleanupState::CleanupUpdate(UpdateInfo &info) {
 }
 
 void CleanupState::CleanupDelete(DeleteInfo &info) {
+	// the deletes might now be visible to all transactions: try to compact the version info of the vector
+	info.version_info->CleanupDelete(lowest_active_transaction, info.vector_idx);
+
 	auto version_table = info.table;
 	if (!version_table->HasIndexes()) {
 		// this table has no indexes: no cleanup to be done
@@ -1,9 +1,11 @@
 #include "duckdb/transaction/duck_transaction_manager.hpp"
 
 #include "duckdb/catalog/catalog_set.hpp"
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/common/exception/transaction_exception.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/thread.hpp"
 #include "duckdb/common/types/timestamp.hpp"
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/catalog/dependency_manager.hpp"
@@ -13,6 +15,8 @@
 #include "duckdb/main/connection_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/valid_checker.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 
 namespace duckdb {
@@ -31,9 +35,11 @@ DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db) : Transacti
 		// Specifically the StorageManager of the DuckCatalog is relied on, with `db.GetStorageManager`
 		throw InternalException("DuckTransactionManager should only be created together with a DuckCatalog");
 	}
+	background_checkpoint = make_shared_ptr<BackgroundCheckpointState>(*this);
 }
 
 DuckTransactionManager::~DuckTransactionManager() {
+	StopBackgroundCheckpoints();
 }
 
 DuckTransactionManager &DuckTransactionManager::Get(AttachedDatabase &db) {
@@ -104,6 +110,12 @@ DuckTransactionManager::CanCheckpoint(DuckTransaction &transaction, unique_ptr<S
 	if (config.options.debug_skip_checkpoint_on_commit) {
 		return CheckpointDecision("checkpointing on commit disabled through configuration");
 	}
+	if (config.options.background_checkpoint && TaskScheduler::GetScheduler(db.GetDatabase()).NumberOfThreads() > 1) {
+		// the checkpoint runs in a background thread after this transaction has committed (to the WAL)
+		CheckpointDecision decision("checkpoint is scheduled in the background");
+		decision.in_background = true;
+		return decision;
+	}
 	// try to lock the checkpoint lock
 	lock = transaction.TryGetCheckpointLock();
 	if (!lock) {
@@ -191,13 +203,151 @@ void DuckTransactionManager::Checkpoint(ClientContext &context, bool force) {
 		}
 	}
 	CheckpointOptions options;
+	options.type = GetCheckpointType();
+	storage_manager.CreateCheckpoint(options);
+}
+
+CheckpointType DuckTransactionManager::GetCheckpointType() {
 	if (GetLastCommit() > LowestActiveStart()) {
 		// we cannot do a full checkpoint if any transaction needs to read old data
-		options.type = CheckpointType::CONCURRENT_CHECKPOINT;
+		return CheckpointType::CONCURRENT_CHECKPOINT;
+	}
+	return CheckpointType::FULL_CHECKPOINT;
+}
+
+//===--------------------------------------------------------------------===//
+// Background Checkpoint
+//===--------------------------------------------------------------------===//
+struct BackgroundCheckpointState {
+	explicit BackgroundCheckpointState(DuckTransactionManager &manager) : manager(manager) {
+	}
+
+	DuckTransactionManager &manager;
+	mutex lock;
+	std::condition_variable finished;
+	//! Whether a background checkpoint task is scheduled (or running)
+	bool scheduled = false;
+	//! Whether the background checkpoint is running
+	bool running = false;
+	//! Whether a commit requested another checkpoint while one was scheduled - it runs once the current one is done
+	bool rerun = false;
+	//! Whether the database is shutting down - no more checkpoints are run
+	bool stopped = false;
+	//! The error of a failed background checkpoint - reported to the next transaction that commits
+	ErrorData error;
+};
+
+//! The WAL size (relative to the checkpoint threshold) from which the background checkpoint stops new transactions
+//! from starting while it waits for the checkpoint lock
+static constexpr idx_t BACKGROUND_CHECKPOINT_FORCE_FACTOR = 2;
+//! The maximum time the background checkpoint keeps new transactions from starting
+static constexpr int64_t BACKGROUND_CHECKPOINT_MAX_WAIT_MS = 100;
+
+class BackgroundCheckpointTask : public Task {
+public:
+	explicit BackgroundCheckpointTask(shared_ptr<BackgroundCheckpointState> state_p) : state(std::move(state_p)) {
 	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		unique_lock<mutex> guard(state->lock);
+		if (state->stopped) {
+			state->scheduled = false;
+			return TaskExecutionResult::TASK_FINISHED;
+		}
+		state->running = true;
+		do {
+			state->rerun = false;
+			guard.unlock();
+			ErrorData error;
+			try {
+				state->manager.BackgroundCheckpoint();
+			} catch (std::exception &ex) {
+				error = ErrorData(ex);
+			} catch (...) { // LCOV_EXCL_START
+				error = ErrorData("Unknown exception during background checkpoint!");
+			} // LCOV_EXCL_STOP
+			guard.lock();
+			if (error.HasError()) {
+				// the WAL is left intact - the checkpoint is attempted again after the next commit
+				state->error = std::move(error);
+				break;
+			}
+		} while (state->rerun && !state->stopped);
+		state->running = false;
+		state->scheduled = false;
+		state->finished.notify_all();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	shared_ptr<BackgroundCheckpointState> state;
+};
+
+void DuckTransactionManager::ScheduleBackgroundCheckpoint() {
+	{
+		lock_guard<mutex> guard(background_checkpoint->lock);
+		if (background_checkpoint->error.HasError()) {
+			// the previous background checkpoint failed - report the error to the committing transaction, just like
+			// a failing automatic checkpoint that runs on the committing thread
+			auto error = std::move(background_checkpoint->error);
+			background_checkpoint->error = ErrorData();
+			error.Throw("Background checkpoint failed: ");
+		}
+		if (background_checkpoint->stopped) {
+			return;
+		}
+		if (background_checkpoint->scheduled) {
+			// the scheduled checkpoint might already have given up on the checkpoint lock, or might not include our
+			// commit - let it run once more when it is done
+			background_checkpoint->rerun = true;
+			return;
+		}
+		background_checkpoint->scheduled = true;
+	}
+	auto &scheduler = TaskScheduler::GetScheduler(db.GetDatabase());
+	auto token = scheduler.CreateProducer();
+	scheduler.ScheduleTask(*token, make_shared_ptr<BackgroundCheckpointTask>(background_checkpoint));
+}
+
+void DuckTransactionManager::BackgroundCheckpoint() {
+	// the checkpoint runs only if no transaction is writing right now
+	// otherwise it is scheduled again by the next commit that exceeds the checkpoint threshold
+	auto &storage_manager = db.GetStorageManager();
+	auto lock = checkpoint_lock.TryGetExclusiveLock();
+	if (!lock) {
+		// under a steady stream of writers the checkpoint lock might never be free - once the WAL has grown well past
+		// the threshold, we stop new transactions from starting (like FORCE CHECKPOINT, but without aborting anyone)
+		// and give the active writers a short while to finish
+		auto &config = DBConfig::GetConfig(db.GetDatabase());
+		if (storage_manager.GetWALSize() < BACKGROUND_CHECKPOINT_FORCE_FACTOR * config.options.checkpoint_wal_size) {
+			return;
+		}
+		lock_guard<mutex> start_lock(start_transaction_lock);
+		auto deadline = steady_clock::now() + milliseconds(BACKGROUND_CHECKPOINT_MAX_WAIT_MS);
+		while (!lock && steady_clock::now() < deadline) {
+			std::this_thread::yield();
+			lock = checkpoint_lock.TryGetExclusiveLock();
+		}
+		if (!lock) {
+			// a writer is still active (e.g. an open transaction) - try again after the next commit
+			return;
+		}
+	}
+	// new transactions can start again - readers run concurrently with the checkpoint, writers wait for it
+	CheckpointOptions options;
+	options.type = GetCheckpointType();
 	storage_manager.CreateCheckpoint(options);
 }
 
+void DuckTransactionManager::StopBackgroundCheckpoints() {
+	if (!background_checkpoint) {
+		return;
+	}
+	unique_lock<mutex> guard(background_checkpoint->lock);
+	background_checkpoint->stopped = true;
+	background_checkpoint->finished.wait(guard, [&]() { return !background_checkpoint->running; });
+}
+
 unique_ptr<StorageLockKey> DuckTransactionManager::SharedCheckpointLock() {
 	return checkpoint_lock.GetSharedLock();
 }
@@ -231,6 +381,8 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	ErrorData error;
 	unique_ptr<lock_guard<mutex>> held_wal_lock;
 	unique_ptr<StorageCommitState> commit_state;
+	optional_ptr<WriteAheadLog> deferred_sync_wal;
+	idx_t deferred_sync_size = 0;
 	if (!checkpoint_decision.can_checkpoint && transaction.ShouldWriteToWAL(db)) {
 		// if we are committing changes and we are not checkpointing, we need to write to the WAL
 		// since WAL writes can take a long time - we grab the WAL lock here and unlock the transaction lock
@@ -258,6 +410,14 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	if (!error.HasError()) {
 		error = transaction.Commit(db, commit_id, std::move(commit_state));
 	}
+	if (!error.HasError() && held_wal_lock) {
+		auto wal = db.GetStorageManager().GetWAL();
+		if (wal && wal->DeferCommitSync()) {
+			// the WAL has not been synced yet - remember up to where it needs to be synced
+			deferred_sync_wal = wal;
+			deferred_sync_size = wal->GetWALSize();
+		}
+	}
 	if (error.HasError()) {
 		// commit unsuccessful: rollback the transaction instead
 		checkpoint_decision = CheckpointDecision(error.Message());
@@ -276,6 +436,26 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		lock.reset();
 	}
 
+	if (deferred_sync_wal) {
+		// group commit: sync the WAL without holding the WAL lock or the transaction lock
+		// other transactions can write their commits to the WAL in the meantime - a single sync makes all of them
+		// durable at once. Note that we sync before removing the transaction: it holds the checkpoint lock, which
+		// prevents the WAL from being truncated while we sync
+		// the commit is visible to transactions that start from here on, i.e. before it is durable. The committing
+		// client is only acknowledged once the sync has succeeded. If the sync fails, the WAL refuses every later
+		// sync and we invalidate the database, so no commit that could have observed this one is acknowledged either
+		held_wal_lock.reset();
+		tlock.unlock();
+		try {
+			deferred_sync_wal->SyncCommit(deferred_sync_size);
+		} catch (std::exception &ex) {
+			// the commit is already visible but might not be durable - the database is in an unknown state
+			error = ErrorData(ex);
+			ValidChecker::Invalidate(db.GetDatabase(), "Failed to sync the WAL after commit: " + error.Message());
+		}
+		tlock.lock();
+	}
+
 	// commit successful: remove the transaction id from the list of active transactions
 	// potentially resulting in garbage collection
 	bool store_transaction = undo_properties.has_updates || undo_properties.has_catalog_changes || error.HasError();
@@ -292,6 +472,9 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		options.type = checkpoint_decision.type;
 		auto &storage_manager = db.GetStorageManager();
 		storage_manager.CreateCheckpoint(options);
+	} else if (checkpoint_decision.in_background && !error.HasError()) {
+		tlock.unlock();
+		ScheduleBackgroundCheckpoint();
 	}
 	return error;
 }
@@ -0,0 +1,137 @@
+#include "catch.hpp"
+#include "duckdb/common/local_file_system.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/virtual_file_system.hpp"
+#include "test_helpers.hpp"
+
+#include <chrono>
+#include <thread>
+
+using namespace duckdb;
+using namespace std;
+
+//! A file system for WAL files that counts their syncs, and fails them once fail_sync is set
+class FailingWALSyncFileSystem : public LocalFileSystem {
+public:
+	explicit FailingWALSyncFileSystem(atomic<bool> &fail_sync, atomic<idx_t> *wal_syncs = nullptr)
+	    : fail_sync(fail_sync), wal_syncs(wal_syncs) {
+	}
+
+	bool CanHandleFile(const string &fpath) override {
+		return StringUtil::EndsWith(fpath, ".wal");
+	}
+
+	void FileSync(FileHandle &handle) override {
+		if (fail_sync) {
+			throw IOException("Injected WAL sync failure");
+		}
+		LocalFileSystem::FileSync(handle);
+		if (wal_syncs) {
+			(*wal_syncs)++;
+		}
+	}
+
+	std::string GetName() const override {
+		return "FailingWALSyncFileSystem";
+	}
+
+private:
+	atomic<bool> &fail_sync;
+	atomic<idx_t> *wal_syncs;
+};
+
+static duckdb::unique_ptr<FileSystem> CreateFileSystem(atomic<bool> &fail_sync, atomic<idx_t> *wal_syncs = nullptr) {
+	auto fs = make_uniq<VirtualFileSystem>();
+	fs->RegisterSubSystem(make_uniq<FailingWALSyncFileSystem>(fail_sync, wal_syncs));
+	return std::move(fs);
+}
+
+TEST_CASE("Test a failing WAL sync with group commit", "[storage][.]") {
+	atomic<bool> fail_sync(false);
+	auto config = GetTestConfig();
+	config->file_system = CreateFileSystem(fail_sync);
+	config->options.checkpoint_wal_size = idx_t(-1);
+	config->options.checkpoint_on_shutdown = false;
+	config->options.wal_group_commit = true;
+	auto storage_database = TestCreatePath("wal_sync_failure");
+	DeleteDatabase(storage_database);
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE tbl (i INTEGER)"));
+		REQUIRE_NO_FAIL(con.Query("INSERT INTO tbl VALUES (1)"));
+
+		// the commit is not acknowledged if its sync fails
+		fail_sync = true;
+		REQUIRE_FAIL(con.Query("INSERT INTO tbl VALUES (2)"));
+		// the commit might have been observed by other transactions - the database is invalidated
+		Connection con2(db);
+		REQUIRE_FAIL(con2.Query("SELECT * FROM tbl"));
+		fail_sync = false;
+		REQUIRE_FAIL(con2.Query("INSERT INTO tbl VALUES (3)"));
+	}
+	DeleteDatabase(storage_database);
+}
+
+TEST_CASE("Test a failing background WAL sync with a sync interval", "[storage][.]") {
+	atomic<bool> fail_sync(false);
+	auto config = GetTestConfig();
+	config->file_system = CreateFileSystem(fail_sync);
+	config->options.checkpoint_wal_size = idx_t(-1);
+	config->options.checkpoint_on_shutdown = false;
+	config->options.wal_sync_interval = 100;
+	auto storage_database = TestCreatePath("wal_sync_failure");
+	DeleteDatabase(storage_database);
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE tbl (i INTEGER)"));
+
+		// the commit leaves the sync to the background flusher, or syncs itself if the interval has already passed
+		fail_sync = true;
+		con.Query("INSERT INTO tbl VALUES (1)");
+		// either way, the failed sync invalidates the database within the interval
+		std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+		REQUIRE_FAIL(con.Query("SELECT * FROM tbl"));
+	}
+	DeleteDatabase(storage_database);
+}
+
+TEST_CASE("Test that the WAL is synced in the background and on close with a sync interval", "[storage][.]") {
+	atomic<bool> fail_sync(false);
+	atomic<idx_t> wal_syncs(0);
+	auto config = GetTestConfig();
+	config->file_system = CreateFileSystem(fail_sync, &wal_syncs);
+	config->options.checkpoint_wal_size = idx_t(-1);
+	config->options.checkpoint_on_shutdown = false;
+	config->options.wal_sync_interval = 1000;
+	auto storage_database = TestCreatePath("wal_sync_failure");
+	DeleteDatabase(storage_database);
+	idx_t syncs_before_close;
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE tbl (i INTEGER)"));
+		for (idx_t i = 0; i < 10; i++) {
+			REQUIRE_NO_FAIL(con.Query("INSERT INTO tbl VALUES (" + to_string(i) + ")"));
+		}
+		// without any further commits, the flusher syncs the deferred commits once the interval has passed
+		idx_t syncs_after_commits = wal_syncs;
+		std::this_thread::sleep_for(std::chrono::milliseconds(3000));
+		REQUIRE(wal_syncs > syncs_after_commits);
+
+		// with a long interval, the deferred commits are synced when the database is closed
+		REQUIRE_NO_FAIL(con.Query("SET wal_sync_interval=3600000"));
+		REQUIRE_NO_FAIL(con.Query("INSERT INTO tbl VALUES (10)"));
+		REQUIRE_NO_FAIL(con.Query("INSERT INTO tbl VALUES (11)"));
+		syncs_before_close = wal_syncs;
+	}
+	REQUIRE(wal_syncs > syncs_before_close);
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		auto result = con.Query("SELECT COUNT(*) FROM tbl");
+		REQUIRE(CHECK_COLUMN(result, 0, {12}));
+	}
+	DeleteDatabase(storage_database);
+}
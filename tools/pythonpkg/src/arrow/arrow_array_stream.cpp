@@ -338,6 +338,12 @@ py::object TransformFilterRecursive(TableFilter *filter, vector<string> &column_
 		auto constant_field = field(py::tuple(py::cast(column_ref)));
 		return constant_field.attr("is_valid")();
 	}
+	//! Bloom and IN filters are generated by joins and are not pushed into Arrow, push is not null instead
+	case TableFilterType::BLOOM_FILTER:
+	case TableFilterType::IN_FILTER: {
+		auto constant_field = field(py::tuple(py::cast(column_ref)));
+		return constant_field.attr("is_valid")();
+	}
 	//! We do not pushdown or conjunctions yet
 	case TableFilterType::CONJUNCTION_OR: {
 		idx_t i = 0;